@@ -60,6 +60,55 @@ extern "C" {
 /* Function prototype declarations */
 /*********************** BMI090L Accelerometer function prototypes ************************/
 
+/**
+ * \ingroup bmi090l
+ * \defgroup bmi090lApiDefaults Device structure defaults
+ * @brief Default values of the optional device structure members
+ */
+
+/*!
+ * \ingroup bmi090lApiDefaults
+ * \page bmi090l_api_bmi090l_set_dev_defaults bmi090l_set_dev_defaults
+ * \code
+ * int8_t bmi090l_set_dev_defaults(struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API sets the optional members of the device structure to
+ *  their defaults, which leave the optional driver features disabled:
+ *
+ *@verbatim
+ *  Member          | Default
+ *  ----------------|---------------------------------------------
+ *  dummy_byte_mode | BMI090L_DUMMY_BYTE_COPY
+ *  xfer            | NULL, register access uses read and write
+ *  read_async      | NULL, no asynchronous FIFO reads
+ *  accel_fifo_en   | BMI090L_FIFO_EN_UNKNOWN
+ *  wait_mode       | BMI090L_WAIT_FIXED
+ *  shadow          | Cache disabled, no register cached
+ *  feature         | Image not loaded, no transaction open
+ *  stats           | NULL, only with BMI090L_BUS_STATS
+ *  timestamp_us    | NULL
+ *  remap           | Identity, no axis re-mapped
+ *@endverbatim
+ *
+ *  It also sets dev->ext_key to BMI090L_DEV_EXT_KEY, so the init APIs keep
+ *  the optional members set afterwards. The interface members (intf,
+ *  intf_ptr_accel, intf_ptr_gyro, read, write, delay_us and read_write_len)
+ *  are left untouched.
+ *
+ *  @note Calling this API is not required. Without the opt-in key,
+ *  bmi090la_init() and bmi090lg_init() apply the same defaults, so existing
+ *  code that fills in only the interface members keeps working. Call it
+ *  before init to set optional members that init already uses, such as
+ *  dummy_byte_mode or shadow.enable.
+ *
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090l_set_dev_defaults(struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiInit Accel Initialization
@@ -74,7 +123,9 @@ extern "C" {
  * \endcode
  * @details This API is the entry point for accel sensor.
  *  It performs the selection of I2C/SPI read mechanism according to the
- *  selected interface and reads the chip-id of accel sensor.
+ *  selected interface and reads the chip-id of accel sensor. It sets the
+ *  axis remap of the device structure to identity, matching the sensor
+ *  after reset.
  *
  *  @param[in,out] dev  : Structure instance of bmi090l_dev.
  *  @note : Refer user guide for detailed info.
@@ -85,6 +136,58 @@ extern "C" {
  */
 int8_t bmi090la_init(struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiInit
+ * \page bmi090la_api_bmi090la_init_start bmi090la_init_start
+ * \code
+ * int8_t bmi090la_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API prepares a non-blocking initialization of the accel
+ *  sensor, run by bmi090la_init_step(). The chip ID check of
+ *  bmi090la_init() always runs. It is followed by the selected steps:
+ *
+ *@verbatim
+ *  steps                    | Action
+ *  -------------------------|------------------------------------------------
+ *  BMI090L_INIT_SOFT_RESET  | bmi090la_soft_reset()
+ *  BMI090L_INIT_CONFIG_FILE | bmi090la_apply_config_file()
+ *  BMI090L_INIT_POWER_MODE  | bmi090la_set_power_mode() with dev->accel_cfg.power
+ *@endverbatim
+ *
+ *  @param[out] ctx    : Initialization context, kept by the caller until done.
+ *  @param[in] steps   : Combination of the BMI090L_INIT_* steps.
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiInit
+ * \page bmi090la_api_bmi090la_init_step bmi090la_init_step
+ * \code
+ * int8_t bmi090la_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API issues the next bus action of the accel initialization
+ *  and returns without calling dev->delay_us. While BMI090L_W_IN_PROGRESS is
+ *  returned, the caller calls it again at the earliest after wait_us, and may
+ *  serve other sensors in the meantime. The config file is written one chunk
+ *  of dev->read_write_len bytes per call. Waits for the sensor follow
+ *  dev->wait_mode.
+ *
+ *  @param[in,out] ctx  : Initialization context of bmi090la_init_start().
+ *  @param[out] wait_us : Minimum time until the next call, 0 to call again at once.
+ *  @param[in,out] dev  : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success, initialization done
+ *  @retval BMI090L_W_IN_PROGRESS -> Call again after wait_us
+ *  @retval < 0 -> Fail, the initialization has to be started again
+ */
+int8_t bmi090la_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laWFconfig Accel Feature config
@@ -114,6 +217,68 @@ int8_t bmi090la_init(struct bmi090l_dev *dev);
  */
 int8_t bmi090la_write_feature_config(uint8_t reg_addr, const uint16_t *reg_data, uint8_t len, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laWFconfig
+ * \page bmi090la_api_bmi090la_feature_config_begin bmi090la_feature_config_begin
+ * \code
+ * int8_t bmi090la_feature_config_begin(struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API opens a feature configuration transaction. Until
+ *  bmi090la_feature_config_commit() or bmi090la_feature_config_abort() is
+ *  called, the feature setters (high-g, low-g, orientation, no-motion,
+ *  any-motion, data synchronization and axis remap) and
+ *  bmi090la_write_feature_config() only update the RAM image of the feature
+ *  space. Getters return the staged values. Other registers, e.g. the
+ *  interrupt mapping, are still written immediately.
+ *
+ *  A soft-reset, a config file upload or a direct write to the feature
+ *  register drops the open transaction.
+ *
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_feature_config_begin(struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laWFconfig
+ * \page bmi090la_api_bmi090la_feature_config_commit bmi090la_feature_config_commit
+ * \code
+ * int8_t bmi090la_feature_config_commit(struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API closes the feature configuration transaction and writes
+ *  all staged changes to the sensor in a single burst, so the sensor
+ *  switches to the new profile at once.
+ *
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_E_INVALID_CONFIG -> No transaction open, or it was dropped
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_feature_config_commit(struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laWFconfig
+ * \page bmi090la_api_bmi090la_feature_config_abort bmi090la_feature_config_abort
+ * \code
+ * int8_t bmi090la_feature_config_abort(struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API closes the feature configuration transaction and
+ *  discards the staged changes. The sensor keeps its previous configuration,
+ *  and the axis remap of the device structure is read back from the sensor.
+ *
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_feature_config_abort(struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiRegs Accel Registers
@@ -377,6 +542,115 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev);
  */
 int8_t bmi090la_get_data(struct bmi090l_sensor_data *accel, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiData
+ * \page bmi090la_api_bmi090la_get_data_with_time bmi090la_get_data_with_time
+ * \code
+ * int8_t bmi090la_get_data_with_time(struct bmi090l_sensor_data *accel, uint32_t *sensor_time, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API reads the accel data and the 24 bit sensor time in one
+ *  burst, as the registers are adjacent. The data is re-mapped as in
+ *  bmi090la_get_data() and the sensor time is taken together with the sample.
+ *
+ *  @param[out] accel       : Structure pointer to store accel data
+ *  @param[out] sensor_time : Pointer to store the sensor time
+ *  @param[in]  dev         : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_get_data_with_time(struct bmi090l_sensor_data *accel, uint32_t *sensor_time, struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiData
+ * \page bmi090la_api_bmi090la_poll_samples bmi090la_poll_samples
+ * \code
+ * int8_t bmi090la_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+ *                              struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API polls the accel data ready status and appends the next
+ *  count samples to the x, y and z arrays of the ring. Each sample is
+ *  re-mapped as in bmi090la_get_data() and, if ring->time_us is set, stamped
+ *  with dev->timestamp_us when data ready was seen. The status is polled
+ *  every BMI090L_SAMPLE_POLL_US, for at most BMI090L_SAMPLE_TIMEOUT_US per sample.
+ *
+ *  @param[in,out] ring   : Sample ring, head and count are updated
+ *  @param[in]     count  : Number of samples to read
+ *  @param[out]    n_read : Number of samples appended to the ring
+ *  @param[in]     dev    : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_PARTIAL_READ -> Data ready timed out before count samples
+ *  @retval BMI090L_E_INVALID_INPUT -> ring->size is 0, ring->head is not below
+ *  ring->size or ring->count is above ring->size
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+                             struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiData
+ * \page bmi090la_api_bmi090la_convert_data bmi090la_convert_data
+ * \code
+ * int8_t bmi090la_convert_data(const struct bmi090l_sensor_data *raw,
+ *                              struct bmi090l_sensor_data_f *data,
+ *                              uint16_t count,
+ *                              uint8_t unit,
+ *                              struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API converts a batch of raw accel samples to float, using
+ *  the range in dev->accel_cfg.range. The scale is computed once per call.
+ *  The range is not read back from the sensor, it has to match the last
+ *  bmi090la_set_meas_conf().
+ *
+ *  @param[in]  raw   : Raw samples, e.g. from bmi090la_extract_accel()
+ *  @param[out] data  : Converted samples, count entries
+ *  @param[in]  count : Number of samples
+ *  @param[in]  unit  : BMI090L_UNIT_G or BMI090L_UNIT_MPS2
+ *  @param[in]  dev   : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_convert_data(const struct bmi090l_sensor_data *raw,
+                             struct bmi090l_sensor_data_f *data,
+                             uint16_t count,
+                             uint8_t unit,
+                             struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiData
+ * \page bmi090la_api_bmi090la_convert_data_q16 bmi090la_convert_data_q16
+ * \code
+ * int8_t bmi090la_convert_data_q16(const struct bmi090l_sensor_data *raw,
+ *                                  struct bmi090l_sensor_data_q16 *data,
+ *                                  uint16_t count,
+ *                                  uint8_t unit,
+ *                                  struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API converts a batch of raw accel samples to Q16.16 fixed
+ *  point, for targets without a floating point unit. The range is taken from
+ *  dev->accel_cfg.range as in bmi090la_convert_data().
+ *
+ *  @param[in]  raw   : Raw samples
+ *  @param[out] data  : Converted samples, count entries
+ *  @param[in]  count : Number of samples
+ *  @param[in]  unit  : BMI090L_UNIT_G or BMI090L_UNIT_MPS2
+ *  @param[in]  dev   : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_convert_data_q16(const struct bmi090l_sensor_data *raw,
+                                 struct bmi090l_sensor_data_q16 *data,
+                                 uint16_t count,
+                                 uint8_t unit,
+                                 struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiIntConfig Accel Interrupt configurations
@@ -498,6 +772,44 @@ int8_t bmi090la_perform_selftest(struct bmi090l_dev *dev);
  */
 int8_t bmi090la_apply_config_file(struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiAConfig
+ * \page bmi090la_api_bmi090la_warm_apply_config_file bmi090la_warm_apply_config_file
+ * \code
+ * int8_t bmi090la_warm_apply_config_file(uint16_t config_major,
+ *                                        uint16_t config_minor,
+ *                                        uint8_t *uploaded,
+ *                                        struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API skips the config file upload if the sensor already runs
+ *  the embedded config file, e.g. after a restart of the host only. The
+ *  sensor is taken as configured if INTERNAL_STAT reports an initialized
+ *  ASIC and the config ID matches config_major and config_minor. Otherwise
+ *  bmi090la_apply_config_file() is called.
+ *
+ *  The driver does not know the config ID of the embedded config file. The
+ *  expected ID is the one read with bmi090la_get_version_config() right
+ *  after a full bmi090la_apply_config_file() of the same config file, e.g.
+ *  stored by the host at the first start.
+ *
+ *  When the upload is skipped, the feature configuration and the axis remap
+ *  of the device structure are read back from the sensor, while the power
+ *  configuration is left unchanged.
+ *
+ *  @param[in] config_major : Expected config major, read back after a full upload.
+ *  @param[in] config_minor : Expected config minor, read back after a full upload.
+ *  @param[out] uploaded    : TRUE if the config file was uploaded, FALSE if skipped.
+ *  @param[in,out] dev      : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_warm_apply_config_file(uint16_t config_major,
+                                       uint16_t config_minor,
+                                       uint8_t *uploaded,
+                                       struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiSyncData Accel Data Synchronization
@@ -578,6 +890,38 @@ int8_t bmi090la_get_synchronized_data(struct bmi090l_sensor_data *accel,
                                       struct bmi090l_sensor_data *gyro,
                                       struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiSData
+ * \page bmi090la_api_bmi090la_get_synchronized_data_status bmi090la_get_synchronized_data_status
+ * \code
+ * int8_t bmi090la_get_synchronized_data_status(struct bmi090l_sensor_data *accel,
+ *                                            struct bmi090l_sensor_data *gyro,
+ *                                            uint8_t *int_status,
+ *                                            struct bmi090l_dev *dev);
+ *
+ * \endcode
+ * @details This API reads the synchronized accel & gyro data together with
+ *  the accel data interrupt status. The accel general purpose registers and,
+ *  if requested, the interrupt status are read in a single burst, followed
+ *  by one gyro data read. Use it in place of bmi090la_get_synchronized_data
+ *  at the higher data synchronization rates.
+ *
+ *  @param[out] accel      : Structure pointer to store accel data
+ *  @param[out] gyro       : Structure pointer to store gyro  data
+ *  @param[out] int_status : Content of the accel INT_STAT_1 register, NULL to skip it
+ *  @param[in]  dev        : Structure instance of bmi090l_dev.
+ *
+ *  @note Reading the interrupt status clears it, as with bmi090la_get_data_int_status.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_get_synchronized_data_status(struct bmi090l_sensor_data *accel,
+                                             struct bmi090l_sensor_data *gyro,
+                                             uint8_t *int_status,
+                                             struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiInt Synchronized interrupt config
@@ -913,6 +1257,33 @@ int8_t bmi090la_set_remap_axes(const struct bmi090l_remap *remapped_axis, struct
  */
 int8_t bmi090la_get_remap_axes(struct bmi090l_remap *remapped_axis, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiRemap
+ * \page bmi090l_api_bmi090la_remap_data bmi090la_remap_data
+ * \code
+ * int8_t bmi090la_remap_data(struct bmi090l_sensor_data *data, uint16_t count, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API applies the axes re-mapping kept in the device structure
+ * to a batch of samples in place. Accel data is re-mapped by the driver
+ * already; use this API for gyro data, e.g. after bmi090lg_extract_gyro(), to
+ * get both sensors in the same frame.
+ *
+ * bmi090la_init() and bmi090lg_init() start from the identity remap, so
+ * gyro-only users get the data unchanged. bmi090la_set_remap_axes() sets a
+ * different remap; it needs an initialized accel sensor.
+ *
+ * @param[in,out] data  : Samples to re-map
+ * @param[in]     count : Number of samples
+ * @param[in]     dev   : Structure instance of bmi090l_dev
+ *
+ * @return Result of API execution status.
+ *
+ * @return 0 -> Success
+ * @return < 0 -> Fail
+ *
+ */
+int8_t bmi090la_remap_data(struct bmi090l_sensor_data *data, uint16_t count, struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiFIFO FIFO Operations
@@ -965,6 +1336,9 @@ int8_t bmi090la_get_fifo_config(struct bmi090l_accel_fifo_config *config, struct
  * @param[in]      dev      : Structure instance of bmi090l_dev.
  *
  * @note APS has to be disabled before calling this function.
+ * @note With dev->dummy_byte_mode = BMI090L_DUMMY_BYTE_HEADROOM on SPI, the
+ * dummy byte is read into fifo->data[0], up to fifo->length - 1 FIFO bytes
+ * follow it and fifo->acc_byte_start_idx is set to 1.
  *
  *  @return Result of API execution status
  *  @retval 0 -> Success
@@ -994,6 +1368,47 @@ int8_t bmi090la_read_fifo_data(struct bmi090l_fifo_frame *fifo, struct bmi090l_d
  */
 int8_t bmi090la_get_fifo_length(uint16_t *fifo_length, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_drain_fifo bmi090la_drain_fifo
+ * \code
+ * int8_t bmi090la_drain_fifo(struct bmi090l_fifo_frame *fifo,
+ *                            uint8_t mode,
+ *                            uint16_t *fifo_length,
+ *                            struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API drains the accel FIFO into fifo->data, ready for the
+ * extraction APIs, with the accel enable bit taken from the driver cache.
+ *
+ * Modes:
+ * - BMI090L_FIFO_DRAIN_EXACT reads the FIFO length, then the FIFO content
+ *   and the sensor time frame behind it, in two transactions.
+ * - BMI090L_FIFO_DRAIN_OVER_READ reads FIFO_LENGTH_0 onwards in a single
+ *   transaction of fifo->length bytes. As the address stays on FIFO_DATA,
+ *   the length is followed by the FIFO content, the sensor time frame and
+ *   over-read bytes, at which the extraction stops. The buffer size bounds
+ *   the over-read, size it for the expected fill level.
+ *
+ * @param[in,out] fifo        : Structure instance of bmi090l_fifo_frame, with
+ *                              fifo->length set to the buffer size and updated
+ *                              to the bytes read. fifo->acc_byte_start_idx is
+ *                              set to the first FIFO byte.
+ * @param[in]     mode        : BMI090L_FIFO_DRAIN_EXACT or BMI090L_FIFO_DRAIN_OVER_READ.
+ * @param[out]    fifo_length : FIFO length in bytes before the drain.
+ * @param[in]     dev         : Structure instance of bmi090l_dev.
+ *
+ * @note APS has to be disabled before calling this function.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_PARTIAL_READ -> The buffer was too small, data is left in the FIFO
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_drain_fifo(struct bmi090l_fifo_frame *fifo,
+                           uint8_t mode,
+                           uint16_t *fifo_length,
+                           struct bmi090l_dev *dev);
+
 /*!
  * \ingroup bmi090laApiFIFO
  * \page bmi090la_api_bmi090la_get_fifo_wm bmi090la_get_fifo_wm
@@ -1040,7 +1455,7 @@ int8_t bmi090la_set_fifo_wm(uint16_t wm, struct bmi090l_dev *dev);
  * \endcode
  * @details This API parses and extracts the accelerometer frames from FIFO data read by
  * the "bmi090l_read_fifo_data" API and stores it in the "accel_data" structure
- * instance.
+ * instance. The data is re-mapped as in bmi090la_get_data().
  *
  * @param[out]    accel_data   : Structure instance of bmi090l_sensor_data
  *                               where the parsed data bytes are stored.
@@ -1057,6 +1472,379 @@ int8_t bmi090la_extract_accel(struct bmi090l_sensor_data *accel_data,
                               struct bmi090l_fifo_frame *fifo,
                               const struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_parser_init bmi090la_fifo_parser_init
+ * \code
+ * int8_t bmi090la_fifo_parser_init(struct bmi090l_fifo_parser *parser);
+ * \endcode
+ * @details This API resets the sensor time and skip frame state of the
+ * streaming FIFO parser and drops a held cut off frame. Call it before the
+ * first chunk and after a FIFO flush.
+ *
+ * @param[out] parser : Structure instance of bmi090l_fifo_parser.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_parser_init(struct bmi090l_fifo_parser *parser);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_parser_new_read bmi090la_fifo_parser_new_read
+ * \code
+ * int8_t bmi090la_fifo_parser_new_read(struct bmi090l_fifo_parser *parser);
+ * \endcode
+ * @details This API drops the cut off frame held by the streaming FIFO
+ * parser and keeps the sensor time and skip frame state. Call it before the
+ * first chunk of each FIFO_DATA read: the sensor sends a frame cut off by the
+ * end of a read again in full on the next read, so the held bytes must not
+ * be completed from it.
+ *
+ * @param[in,out] parser : Structure instance of bmi090l_fifo_parser.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_parser_new_read(struct bmi090l_fifo_parser *parser);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_parse bmi090la_fifo_parse
+ * \code
+ * int8_t bmi090la_fifo_parse(struct bmi090l_fifo_parser *parser,
+ *                            const uint8_t *data,
+ *                            uint16_t *data_length,
+ *                            struct bmi090l_sensor_data *accel_data,
+ *                            uint16_t *accel_length,
+ *                            const struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API parses a chunk of header mode FIFO data of any length.
+ * The chunks of one FIFO_DATA read may be split anywhere, e.g. by a DMA
+ * buffer: a frame cut off at the end of a chunk is held in the parser, at
+ * most 7 bytes, and completed by the next chunk. Call
+ * bmi090la_fifo_parser_new_read() before the first chunk of each further
+ * FIFO_DATA read, as the sensor sends a cut off frame again on the next read.
+ * The accel data is re-mapped as in bmi090la_get_data(); sensor time and skip
+ * frames update the parser.
+ *
+ * @param[in,out] parser       : Structure instance of bmi090l_fifo_parser.
+ * @param[in]     data         : FIFO data, without the SPI dummy byte.
+ * @param[in,out] data_length  : Bytes in data, updated to the bytes consumed, including
+ *                               the bytes of a cut off frame held in the parser.
+ * @param[out]    accel_data   : Parsed accel samples.
+ * @param[in,out] accel_length : Size of accel_data, updated to the samples parsed.
+ * @param[in]     dev          : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success, the chunk is consumed
+ *  @retval BMI090L_W_FIFO_EMPTY -> End of the FIFO data, the rest of the chunk is dropped
+ *  @retval BMI090L_W_PARTIAL_READ -> accel_data is full, pass the rest of the chunk again
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_parse(struct bmi090l_fifo_parser *parser,
+                           const uint8_t *data,
+                           uint16_t *data_length,
+                           struct bmi090l_sensor_data *accel_data,
+                           uint16_t *accel_length,
+                           const struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_visit_fifo bmi090la_visit_fifo
+ * \code
+ * int8_t bmi090la_visit_fifo(struct bmi090l_fifo_frame *fifo,
+ *                            const struct bmi090l_fifo_visitor *visitor,
+ *                            const struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API walks the FIFO data read by bmi090la_read_fifo_data()
+ * once and calls the visitor callback of each frame type, in FIFO order.
+ * Accel samples are re-mapped as in bmi090la_get_data(). Parsing starts at
+ * fifo->acc_byte_start_idx, which is advanced past the visited frames.
+ *
+ * @param[in,out] fifo    : Structure instance of bmi090l_fifo_frame.
+ * @param[in]     visitor : Callbacks, NULL members are skipped.
+ * @param[in]     dev     : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_FIFO_EMPTY -> Stopped at the end of the FIFO data or a cut off frame
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_visit_fifo(struct bmi090l_fifo_frame *fifo,
+                           const struct bmi090l_fifo_visitor *visitor,
+                           const struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_get_fifo_events bmi090la_get_fifo_events
+ * \code
+ * int8_t bmi090la_get_fifo_events(struct bmi090l_fifo_event *events,
+ *                                 uint16_t *event_count,
+ *                                 struct bmi090l_fifo_frame *fifo,
+ *                                 const struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API walks the FIFO data read by bmi090la_read_fifo_data()
+ * once and stores one tagged event per frame, in FIFO order. Parsing starts
+ * at fifo->acc_byte_start_idx, which is advanced past the stored frames, so
+ * a full event array can be continued with another call.
+ *
+ * @param[out]    events      : Array of bmi090l_fifo_event.
+ * @param[in,out] event_count : Size of events, updated to the events stored.
+ * @param[in,out] fifo        : Structure instance of bmi090l_fifo_frame.
+ * @param[in]     dev         : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_FIFO_EMPTY -> Stopped at the end of the FIFO data or a cut off frame
+ *  @retval BMI090L_W_PARTIAL_READ -> events is full, more frames follow
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_get_fifo_events(struct bmi090l_fifo_event *events,
+                                uint16_t *event_count,
+                                struct bmi090l_fifo_frame *fifo,
+                                const struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_extract_accel_time bmi090la_extract_accel_time
+ * \code
+ * int8_t bmi090la_extract_accel_time(struct bmi090l_sensor_data *accel_data,
+ *                                    uint64_t *sample_time,
+ *                                    uint16_t *accel_length,
+ *                                    struct bmi090l_fifo_frame *fifo,
+ *                                    struct bmi090l_fifo_timeline *timeline,
+ *                                    struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API extracts the accel samples of the FIFO data read by
+ * bmi090la_read_fifo_data(), like bmi090la_extract_accel(), and gives each
+ * sample its time in sensor time ticks (39.0625 us).
+ *
+ * Samples are taken on the sensor time grid of the accel ODR, divided down
+ * by the FIFO down-sampling. In stream mode the last frame before the
+ * sensor time frame at the end of the data is placed on the grid point at
+ * or before it, and the samples are back-filled one sample period apart,
+ * leaving a gap for the frames counted by skip frames. When accel_data is
+ * full, the frames left for the next call are counted the same way. In FIFO
+ * mode, and when the data has no sensor time frame, the samples continue
+ * from the last sample of the timeline, as frames lost to a full FIFO are
+ * only reported by a later skip frame.
+ *
+ * The 24 bit sensor time is extended to 64 bit in the timeline, so sample
+ * times keep increasing across the wrap of the counter. This holds as long
+ * as FIFO reads with a sensor time frame are less than 655 s apart.
+ *
+ * @note The timeline has to be zero initialized before the first call, and
+ * again after the FIFO configuration or the ODR is changed. The API does
+ * not access the bus. The accel ODR is taken from dev->accel_cfg. The FIFO
+ * mode and down-sampling are taken from the shadow cache when it is enabled,
+ * else from timeline->fifo_mode and timeline->fifo_downs; zero matches the
+ * sensor after reset.
+ *
+ * @param[out]    accel_data   : Structure instance of bmi090l_sensor_data.
+ * @param[out]    sample_time  : Time of each sample, in sensor time ticks.
+ * @param[in,out] accel_length : Size of accel_data, updated to the samples extracted.
+ * @param[in,out] fifo         : Structure instance of bmi090l_fifo_frame.
+ * @param[in,out] timeline     : Structure instance of bmi090l_fifo_timeline.
+ * @param[in]     dev          : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_FIFO_EMPTY -> Stopped at the end of the FIFO data or a cut off frame
+ *  @retval BMI090L_W_PARTIAL_READ -> accel_data is full, more frames follow
+ *  @retval BMI090L_W_NO_SENSOR_TIME -> No sensor time yet, sample_time is zero
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_extract_accel_time(struct bmi090l_sensor_data *accel_data,
+                                   uint64_t *sample_time,
+                                   uint16_t *accel_length,
+                                   struct bmi090l_fifo_frame *fifo,
+                                   struct bmi090l_fifo_timeline *timeline,
+                                   struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_merge_fifo bmi090la_merge_fifo
+ * \code
+ * int8_t bmi090la_merge_fifo(const struct bmi090l_sensor_data *accel_data,
+ *                            const uint64_t *accel_time,
+ *                            uint16_t accel_length,
+ *                            const struct bmi090l_sensor_data *gyro_data,
+ *                            uint16_t gyro_length,
+ *                            struct bmi090l_fifo_sample *samples,
+ *                            uint16_t *sample_count,
+ *                            struct bmi090l_fifo_merger *merger,
+ *                            const struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API merges the accel samples of bmi090la_extract_accel_time()
+ * and the gyro samples of bmi090lg_extract_gyro() from one FIFO drain into
+ * one stream ordered by time, in ns on the sensor time base.
+ *
+ * The gyro FIFO has no sensor time. The gyro samples are placed one gyro
+ * period apart, ending half a period before the accel sensor time of the
+ * drain. Between drains the time of the last gyro sample and the gyro
+ * period are tracked, so the read jitter is filtered and the gyro clock is
+ * followed. A time error above BMI090L_GYRO_TIME_RESYNC periods, e.g. after
+ * a gyro FIFO overrun, restarts the tracking. The estimated gyro times keep
+ * a small error, so the first samples of a drain may overlap the last ones
+ * of the previous drain by a fraction of a gyro period.
+ *
+ * @note Read the gyro FIFO right after the accel FIFO and pass
+ * merger->accel_timeline to bmi090la_extract_accel_time(). The merger has to
+ * be zero initialized before the first call. The gyro ODR is taken from
+ * dev->gyro_cfg.
+ *
+ * @param[in]     accel_data   : Accel samples.
+ * @param[in]     accel_time   : Time of the accel samples, in sensor time ticks.
+ * @param[in]     accel_length : Number of accel samples.
+ * @param[in]     gyro_data    : Gyro samples, all samples of one gyro FIFO read.
+ * @param[in]     gyro_length  : Number of gyro samples.
+ * @param[out]    samples      : Merged samples.
+ * @param[in,out] sample_count : Size of samples, at least accel_length plus
+ *                               gyro_length, updated to the samples stored.
+ * @param[in,out] merger       : Structure instance of bmi090l_fifo_merger.
+ * @param[in]     dev          : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_NO_SENSOR_TIME -> No sensor time yet, nothing is stored
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_merge_fifo(const struct bmi090l_sensor_data *accel_data,
+                           const uint64_t *accel_time,
+                           uint16_t accel_length,
+                           const struct bmi090l_sensor_data *gyro_data,
+                           uint16_t gyro_length,
+                           struct bmi090l_fifo_sample *samples,
+                           uint16_t *sample_count,
+                           struct bmi090l_fifo_merger *merger,
+                           const struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_resampler_init bmi090la_fifo_resampler_init
+ * \code
+ * int8_t bmi090la_fifo_resampler_init(struct bmi090l_fifo_resampler *resampler, uint32_t period_ns);
+ * \endcode
+ * @details This API initializes the resampler of bmi090la_resample_fifo()
+ * for a grid of the given period.
+ *
+ * @param[out] resampler : Structure instance of bmi090l_fifo_resampler.
+ * @param[in]  period_ns : Grid period in ns.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_resampler_init(struct bmi090l_fifo_resampler *resampler, uint32_t period_ns);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_resample_fifo bmi090la_resample_fifo
+ * \code
+ * int8_t bmi090la_resample_fifo(const struct bmi090l_fifo_sample *samples,
+ *                               uint16_t *sample_count,
+ *                               struct bmi090l_imu_sample *imu_data,
+ *                               uint16_t *imu_length,
+ *                               struct bmi090l_fifo_resampler *resampler);
+ * \endcode
+ * @details This API resamples the stream of bmi090la_merge_fifo() onto a
+ * grid of multiples of the resampler period, starting after the first
+ * sample of both sensors. Each grid point holds accel and gyro data,
+ * linearly interpolated between the samples around it.
+ *
+ * A grid point is stored once both sensors have a sample at or after it. If
+ * one sensor runs more than BMI090L_FIFO_RESAMPLE_DEPTH grid points ahead,
+ * e.g. at a low ODR, the other sensor holds its last sample.
+ *
+ * @param[in]     samples      : Merged samples, in time order.
+ * @param[in,out] sample_count : Number of samples, updated to the samples consumed.
+ * @param[out]    imu_data     : Grid points.
+ * @param[in,out] imu_length   : Size of imu_data, updated to the grid points stored.
+ * @param[in,out] resampler    : Structure instance of bmi090l_fifo_resampler.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_PARTIAL_READ -> imu_data is full, pass the rest of the samples again
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_resample_fifo(const struct bmi090l_fifo_sample *samples,
+                              uint16_t *sample_count,
+                              struct bmi090l_imu_sample *imu_data,
+                              uint16_t *imu_length,
+                              struct bmi090l_fifo_resampler *resampler);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_wm_ctrl_init bmi090la_fifo_wm_ctrl_init
+ * \code
+ * int8_t bmi090la_fifo_wm_ctrl_init(struct bmi090l_fifo_wm_ctrl *ctrl,
+ *                                   uint16_t accel_wm,
+ *                                   uint8_t gyro_wm,
+ *                                   struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API initializes the FIFO watermark controller with the
+ * watermarks currently set in the sensor. When the accel FIFO is
+ * controlled, its down-sampling is read once here; call it again after
+ * changing the down-sampling.
+ *
+ * @param[out] ctrl     : Structure instance of bmi090l_fifo_wm_ctrl.
+ * @param[in]  accel_wm : Accel watermark in bytes, 0 to leave the accel FIFO alone.
+ * @param[in]  gyro_wm  : Gyro watermark in frames, 0 to leave the gyro FIFO alone.
+ * @param[in]  dev      : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_wm_ctrl_init(struct bmi090l_fifo_wm_ctrl *ctrl,
+                                  uint16_t accel_wm,
+                                  uint8_t gyro_wm,
+                                  struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_update_fifo_wm bmi090la_update_fifo_wm
+ * \code
+ * int8_t bmi090la_update_fifo_wm(struct bmi090l_fifo_wm_ctrl *ctrl,
+ *                                uint16_t accel_fill,
+ *                                uint8_t gyro_fill,
+ *                                struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API retunes the accel and gyro FIFO watermarks to the
+ * service latency of the host, to drain the FIFOs as rarely as possible
+ * without losing frames.
+ *
+ * Call it on each watermark interrupt with the FIFO fill levels read before
+ * draining. The frames beyond the watermark give the time between the
+ * interrupt and the drain. Its mean and deviation are smoothed as for the
+ * TCP retransmission timer, its peak decays slowly, and a fill level within
+ * a frame of the capacity raises them at once. The watermarks then leave
+ * room for the frames of the larger of the peak and the mean latency plus
+ * four deviations, plus BMI090L_FIFO_WM_MARGIN_US. A lower
+ * watermark is written at once, a higher one only when it differs by more
+ * than the capacity shifted right by BMI090L_FIFO_WM_HYSTERESIS_SHIFT.
+ *
+ * @note The ODRs are taken from dev->accel_cfg and dev->gyro_cfg, the accel
+ * FIFO down-sampling from the controller, see bmi090la_fifo_wm_ctrl_init().
+ * The accel watermark assumes accel frames with header.
+ *
+ * @param[in,out] ctrl       : Structure instance of bmi090l_fifo_wm_ctrl.
+ * @param[in]     accel_fill : Accel FIFO length in bytes, see bmi090la_get_fifo_length().
+ * @param[in]     gyro_fill  : Gyro FIFO frame count, see bmi090lg_get_fifo_config().
+ * @param[in]     dev        : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_update_fifo_wm(struct bmi090l_fifo_wm_ctrl *ctrl,
+                               uint16_t accel_fill,
+                               uint8_t gyro_fill,
+                               struct bmi090l_dev *dev);
+
 /*!
  * \ingroup bmi090laApiFIFO
  * \page bmi090la_api_bmi090la_get_fifo_down_sample bmi090la_get_fifo_down_sample
@@ -1092,6 +1880,48 @@ int8_t bmi090la_get_fifo_down_sample(uint8_t *fifo_downs, struct bmi090l_dev *de
  */
 int8_t bmi090la_set_fifo_down_sample(uint8_t fifo_downs, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_read_start bmi090la_fifo_read_start
+ * \code
+ * int8_t bmi090la_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking read of the accel FIFO through
+ * dev->read_async into xfer->fifo. The data is read in place: on SPI the
+ * dummy byte is kept in front of the FIFO bytes and acc_byte_start_idx
+ * points after it, as with BMI090L_DUMMY_BYTE_HEADROOM. The FIFO enable bit
+ * is taken from the driver's cache, so no register is read after the data.
+ *
+ * @param[in,out] xfer : Transfer with fifo, done and done_ctx set.
+ * @param[in]     dev  : Structure instance of bmi090l_dev.
+ *
+ * @note The completion callback runs from bmi090la_fifo_read_complete() and
+ * may call bmi090la_extract_accel() on xfer->fifo.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success, transfer in flight or already completed
+ *  @retval < 0 -> Fail, BMI090L_E_BUSY if the transfer is still in flight
+ */
+int8_t bmi090la_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090laApiFIFO
+ * \page bmi090la_api_bmi090la_fifo_read_complete bmi090la_fifo_read_complete
+ * \code
+ * int8_t bmi090la_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt);
+ * \endcode
+ * @details This API is called by the platform when the transfer started by
+ * bmi090la_fifo_read_start() has finished. It runs the completion callback.
+ *
+ * @param[in,out] xfer      : Finished transfer.
+ * @param[in]     intf_rslt : Result of the bus transfer.
+ *
+ *  @return Result of the transfer
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090la_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt);
+
 /*********************** BMI09 Gyroscope function prototypes ****************************/
 
 /**
@@ -1108,7 +1938,9 @@ int8_t bmi090la_set_fifo_down_sample(uint8_t fifo_downs, struct bmi090l_dev *dev
  * \endcode
  * @details This API is the entry point for gyro sensor.
  *  It performs the selection of I2C/SPI read mechanism according to the
- *  selected interface and reads the chip-id of gyro sensor.
+ *  selected interface and reads the chip-id of gyro sensor. The axis remap
+ *  of the device structure is left as the identity set by the defaults (see
+ *  bmi090l_set_dev_defaults()) or as set up through the accel APIs.
  *
  *  @param[in,out] dev : Structure instance of bmi090l_dev.
  *  @note : Refer user guide for detailed info.
@@ -1119,6 +1951,57 @@ int8_t bmi090la_set_fifo_down_sample(uint8_t fifo_downs, struct bmi090l_dev *dev
  */
 int8_t bmi090lg_init(struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090lgApiInit
+ * \page bmi090lg_api_bmi090lg_init_start bmi090lg_init_start
+ * \code
+ * int8_t bmi090lg_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API prepares a non-blocking initialization of the gyro
+ *  sensor, run by bmi090lg_init_step(). The chip ID check of
+ *  bmi090lg_init() always runs. It is followed by the selected steps:
+ *
+ *@verbatim
+ *  steps                    | Action
+ *  -------------------------|------------------------------------------------
+ *  BMI090L_INIT_SOFT_RESET  | bmi090lg_soft_reset()
+ *  BMI090L_INIT_POWER_MODE  | bmi090lg_set_power_mode() with dev->gyro_cfg.power
+ *@endverbatim
+ *
+ *  BMI090L_INIT_CONFIG_FILE is ignored.
+ *
+ *  @param[out] ctx    : Initialization context, kept by the caller until done.
+ *  @param[in] steps   : Combination of the BMI090L_INIT_* steps.
+ *  @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090lg_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090lgApiInit
+ * \page bmi090lg_api_bmi090lg_init_step bmi090lg_init_step
+ * \code
+ * int8_t bmi090lg_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API issues the next bus action of the gyro initialization
+ *  and returns without calling dev->delay_us. While BMI090L_W_IN_PROGRESS is
+ *  returned, the caller calls it again at the earliest after wait_us. Waits
+ *  for the sensor follow dev->wait_mode.
+ *
+ *  @param[in,out] ctx  : Initialization context of bmi090lg_init_start().
+ *  @param[out] wait_us : Minimum time until the next call, 0 to call again at once.
+ *  @param[in,out] dev  : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success, initialization done
+ *  @retval BMI090L_W_IN_PROGRESS -> Call again after wait_us
+ *  @retval < 0 -> Fail, the initialization has to be started again
+ */
+int8_t bmi090lg_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090lgApiRegs Gyro Registers
@@ -1300,6 +2183,95 @@ int8_t bmi090lg_set_power_mode(struct bmi090l_dev *dev);
  */
 int8_t bmi090lg_get_data(struct bmi090l_sensor_data *gyro, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090lgApiData
+ * \page bmi090lg_api_bmi090lg_poll_samples bmi090lg_poll_samples
+ * \code
+ * int8_t bmi090lg_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+ *                              struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API polls the gyro data ready status and appends the next
+ *  count samples to the x, y and z arrays of the ring. If ring->time_us is
+ *  set, each sample is stamped with dev->timestamp_us when data ready was
+ *  seen. The status is polled every BMI090L_SAMPLE_POLL_US, for at most
+ *  BMI090L_SAMPLE_TIMEOUT_US per sample.
+ *
+ *  @param[in,out] ring   : Sample ring, head and count are updated
+ *  @param[in]     count  : Number of samples to read
+ *  @param[out]    n_read : Number of samples appended to the ring
+ *  @param[in]     dev    : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval BMI090L_W_PARTIAL_READ -> Data ready timed out before count samples
+ *  @retval BMI090L_E_INVALID_INPUT -> ring->size is 0, ring->head is not below
+ *  ring->size or ring->count is above ring->size
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090lg_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+                             struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090lgApiData
+ * \page bmi090lg_api_bmi090lg_convert_data bmi090lg_convert_data
+ * \code
+ * int8_t bmi090lg_convert_data(const struct bmi090l_sensor_data *raw,
+ *                              struct bmi090l_sensor_data_f *data,
+ *                              uint16_t count,
+ *                              uint8_t unit,
+ *                              struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API converts a batch of raw gyro samples to float, using
+ *  the range in dev->gyro_cfg.range. The scale is computed once per call.
+ *  The range is not read back from the sensor, it has to match the last
+ *  bmi090lg_set_meas_conf().
+ *
+ *  @param[in]  raw   : Raw samples, e.g. from bmi090lg_extract_gyro()
+ *  @param[out] data  : Converted samples, count entries
+ *  @param[in]  count : Number of samples
+ *  @param[in]  unit  : BMI090L_UNIT_DPS or BMI090L_UNIT_RPS
+ *  @param[in]  dev   : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090lg_convert_data(const struct bmi090l_sensor_data *raw,
+                             struct bmi090l_sensor_data_f *data,
+                             uint16_t count,
+                             uint8_t unit,
+                             struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090lgApiData
+ * \page bmi090lg_api_bmi090lg_convert_data_q16 bmi090lg_convert_data_q16
+ * \code
+ * int8_t bmi090lg_convert_data_q16(const struct bmi090l_sensor_data *raw,
+ *                                  struct bmi090l_sensor_data_q16 *data,
+ *                                  uint16_t count,
+ *                                  uint8_t unit,
+ *                                  struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API converts a batch of raw gyro samples to Q16.16 fixed
+ *  point, for targets without a floating point unit. The range is taken from
+ *  dev->gyro_cfg.range as in bmi090lg_convert_data().
+ *
+ *  @param[in]  raw   : Raw samples
+ *  @param[out] data  : Converted samples, count entries
+ *  @param[in]  count : Number of samples
+ *  @param[in]  unit  : BMI090L_UNIT_DPS or BMI090L_UNIT_RPS
+ *  @param[in]  dev   : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090lg_convert_data_q16(const struct bmi090l_sensor_data *raw,
+                                 struct bmi090l_sensor_data_q16 *data,
+                                 uint16_t count,
+                                 uint8_t unit,
+                                 struct bmi090l_dev *dev);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090lgApiIntConfig Gyro Interrupt configurations
@@ -1458,6 +2430,41 @@ int8_t bmi090lg_get_fifo_length(const struct bmi090l_gyr_fifo_config *fifo_confi
  */
 int8_t bmi090lg_read_fifo_data(const struct bmi090l_fifo_frame *fifo, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090lgApiFIFO
+ * \page bmi090lg_api_bmi090lg_drain_fifo bmi090lg_drain_fifo
+ * \code
+ * int8_t bmi090lg_drain_fifo(struct bmi090l_fifo_frame *fifo,
+ *                            struct bmi090l_gyr_fifo_config *fifo_conf,
+ *                            uint8_t *fifo_overrun,
+ *                            struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API drains the gyro FIFO. The FIFO status and configuration
+ * are read in one batch, answered from the shadow register cache where
+ * possible, and the FIFO data read is sized from the frame count, data_select
+ * and tag. It replaces the bmi090lg_get_fifo_config(),
+ * bmi090lg_get_fifo_length(), bmi090lg_read_fifo_data() and
+ * bmi090lg_get_fifo_overrun() sequence; an empty FIFO takes no data read.
+ *
+ * @param[in,out] fifo         : Structure instance of bmi090l_fifo_frame, with
+ *                               fifo->length set to the buffer size and updated
+ *                               to the bytes read.
+ * @param[out]    fifo_conf    : FIFO configuration, with frame_count set to the
+ *                               frames read, for bmi090lg_extract_gyro().
+ * @param[out]    fifo_overrun : The value of fifo over run.
+ * @param[in]     dev          : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI090L_W_FIFO_EMPTY -> No frame in the FIFO
+ * @retval BMI090L_W_PARTIAL_READ -> The buffer was too small, frames are left in the FIFO
+ * @retval <0 -> Fail
+ */
+int8_t bmi090lg_drain_fifo(struct bmi090l_fifo_frame *fifo,
+                           struct bmi090l_gyr_fifo_config *fifo_conf,
+                           uint8_t *fifo_overrun,
+                           struct bmi090l_dev *dev);
+
 /*!
  * \ingroup bmi090lgApiFIFO
  * \page bmi090lg_api_bmi090lg_extract_gyro bmi090lg_extract_gyro
@@ -1469,7 +2476,7 @@ int8_t bmi090lg_read_fifo_data(const struct bmi090l_fifo_frame *fifo, struct bmi
  * \endcode
  * @details This API parses and extracts the gyroscope frames from FIFO data read by the
  * "bmi090lg_read_fifo_data" API and stores it in the "gyro_data"
- * structure instance.
+ * structure instance. The data is not re-mapped, see bmi090la_remap_data().
  *
  * @param[out]    gyro_data    : Structure instance of bmi090l_sensor_data
  *                               where the parsed data bytes are stored.
@@ -1487,6 +2494,39 @@ void bmi090lg_extract_gyro(struct bmi090l_sensor_data *gyro_data,
                            const struct bmi090l_gyr_fifo_config *fifo_conf,
                            const struct bmi090l_fifo_frame *fifo);
 
+/*!
+ * \ingroup bmi090lgApiFIFO
+ * \page bmi090lg_api_bmi090lg_extract_gyro_packed bmi090lg_extract_gyro_packed
+ * \code
+ * int8_t bmi090lg_extract_gyro_packed(int16_t *gyro_data,
+ *                                    uint16_t *tag,
+ *                                    uint16_t *frame_count,
+ *                                    const struct bmi090l_gyr_fifo_config *fifo_conf,
+ *                                    const struct bmi090l_fifo_frame *fifo);
+ * \endcode
+ * @details This API extracts the gyroscope frames from FIFO data into a packed
+ * int16_t array: x, y, z per frame with all axes selected, or one value per
+ * frame with a single axis selected. With tagging enabled, the interrupt tag
+ * of each frame is returned alongside. The data is not re-mapped.
+ *
+ * @param[out]    gyro_data   : Packed data, three or one value per frame.
+ * @param[out]    tag         : Interrupt tag per frame, can be NULL. Only written
+ *                              with fifo_conf->tag set.
+ * @param[in,out] frame_count : Capacity in frames, updated to the frames extracted.
+ * @param[in]     fifo_conf   : data_select and tag as set in the sensor.
+ * @param[in]     fifo        : Structure instance of bmi090l_fifo_frame.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI090L_W_PARTIAL_READ -> gyro_data is full, frames are left unextracted
+ * @retval <0 -> Fail
+ */
+int8_t bmi090lg_extract_gyro_packed(int16_t *gyro_data,
+                                    uint16_t *tag,
+                                    uint16_t *frame_count,
+                                    const struct bmi090l_gyr_fifo_config *fifo_conf,
+                                    const struct bmi090l_fifo_frame *fifo);
+
 /*!
  * \ingroup bmi090lgApiFIFO
  * \page bmi090lg_api_bmi090lg_get_fifo_overrun bmi090lg_get_fifo_overrun
@@ -1525,6 +2565,42 @@ int8_t bmi090lg_get_fifo_overrun(uint8_t *fifo_overrun, struct bmi090l_dev *dev)
  */
 int8_t bmi090lg_enable_watermark(uint8_t enable, struct bmi090l_dev *dev);
 
+/*!
+ * \ingroup bmi090lgApiFIFO
+ * \page bmi090lg_api_bmi090lg_fifo_read_start bmi090lg_fifo_read_start
+ * \code
+ * int8_t bmi090lg_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API starts a non-blocking read of xfer->fifo->length bytes
+ * of the gyro FIFO through dev->read_async.
+ *
+ * @param[in,out] xfer : Transfer with fifo, done and done_ctx set.
+ * @param[in]     dev  : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success, transfer in flight or already completed
+ *  @retval < 0 -> Fail, BMI090L_E_BUSY if the transfer is still in flight
+ */
+int8_t bmi090lg_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev);
+
+/*!
+ * \ingroup bmi090lgApiFIFO
+ * \page bmi090lg_api_bmi090lg_fifo_read_complete bmi090lg_fifo_read_complete
+ * \code
+ * int8_t bmi090lg_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt);
+ * \endcode
+ * @details This API is called by the platform when the transfer started by
+ * bmi090lg_fifo_read_start() has finished. It runs the completion callback.
+ *
+ * @param[in,out] xfer      : Finished transfer.
+ * @param[in]     intf_rslt : Result of the bus transfer.
+ *
+ *  @return Result of the transfer
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090lg_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt);
+
 /**
  * \ingroup bmi090l
  * \defgroup bmi090laApiVersion Major and Minor Revision
@@ -1550,6 +2626,53 @@ int8_t bmi090lg_enable_watermark(uint8_t enable, struct bmi090l_dev *dev);
  */
 int8_t bmi090la_get_version_config(uint16_t *config_major, uint16_t *config_minor, struct bmi090l_dev *dev);
 
+#ifdef BMI090L_BUS_STATS
+
+/**
+ * \ingroup bmi090l
+ * \defgroup bmi090lApiStats Bus statistics
+ * @brief Per API bus transaction counts, byte counts and latency histograms,
+ * compiled in with BMI090L_BUS_STATS
+ */
+
+/*!
+ * \ingroup bmi090lApiStats
+ * \page bmi090l_api_bmi090l_stats_reset bmi090l_stats_reset
+ * \code
+ * int8_t bmi090l_stats_reset(struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API clears the statistics attached to dev->stats. Counting
+ * starts once dev->stats points to a statistics structure; latencies are
+ * recorded when dev->timestamp_us is set as well.
+ *
+ * @param[in,out] dev : Structure instance of bmi090l_dev.
+ *
+ *  @return Result of API execution status
+ *  @retval 0 -> Success
+ *  @retval < 0 -> Fail
+ */
+int8_t bmi090l_stats_reset(struct bmi090l_dev *dev);
+
+/*!
+ * @brief Internal hooks of the bus statistics, called through the
+ * BMI090L_STATS_* macros below. Not to be called by the user.
+ */
+void bmi090l_stats_enter(struct bmi090l_dev *dev, uint8_t api);
+void bmi090l_stats_exit(struct bmi090l_dev *dev);
+void bmi090l_stats_bus(struct bmi090l_dev *dev, uint8_t dir, uint32_t len);
+void bmi090l_stats_xfer(struct bmi090l_dev *dev, const struct bmi090l_xfer_seg *seg, uint8_t count);
+
+#define BMI090L_STATS_ENTER(dev, api)      bmi090l_stats_enter((dev), (api))
+#define BMI090L_STATS_EXIT(dev)            bmi090l_stats_exit(dev)
+#define BMI090L_STATS_BUS(dev, dir, len)   bmi090l_stats_bus((dev), (dir), (len))
+#define BMI090L_STATS_XFER(dev, seg, cnt)  bmi090l_stats_xfer((dev), (seg), (cnt))
+#else
+#define BMI090L_STATS_ENTER(dev, api)      ((void)0)
+#define BMI090L_STATS_EXIT(dev)            ((void)0)
+#define BMI090L_STATS_BUS(dev, dir, len)   ((void)0)
+#define BMI090L_STATS_XFER(dev, seg, cnt)  ((void)0)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
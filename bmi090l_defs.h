@@ -362,6 +362,10 @@
 /**\name    Config ID start address */
 #define BMI090L_ADDR_CONFIG_ID_START                 UINT8_C(0x1A)
 
+/**\name    Feature configuration space in 16bit words, the config ID word is read-only */
+#define BMI090L_FEATURE_WORDS                        UINT8_C(0x0F)
+#define BMI090L_CONFIG_ID_WORD                       UINT8_C(0x0D)
+
 /*************************** BMI09 Gyroscope Macros *****************************/
 /** Register map */
 /* Gyro registers */
@@ -579,6 +583,174 @@
 #define BMI090L_SPI_RD_MASK                          UINT8_C(0x80)
 #define BMI090L_SPI_WR_MASK                          UINT8_C(0x7F)
 
+/**\name    SPI dummy byte handling of accel reads
+ * COPY     : read into a stack buffer and copy the data to the caller (default)
+ * HEADROOM : FIFO reads land in the caller's buffer, which starts with the dummy byte
+ * INTF     : the read callback drops the dummy byte, data is read in place
+ */
+#define BMI090L_DUMMY_BYTE_COPY                      UINT8_C(0x00)
+#define BMI090L_DUMMY_BYTE_HEADROOM                  UINT8_C(0x01)
+#define BMI090L_DUMMY_BYTE_INTF                      UINT8_C(0x02)
+
+/**\name    Cached accel FIFO enable bit is not known */
+#define BMI090L_FIFO_EN_UNKNOWN                      UINT8_C(0xFF)
+
+/**\name    Opt-in key of the optional device structure members, see bmi090l_dev.ext_key */
+#define BMI090L_DEV_EXT_KEY                          UINT32_C(0x42303930)
+
+/**\name    Waiting for the sensor after resets, config load and power mode switches */
+#define BMI090L_WAIT_FIXED                           UINT8_C(0x00)
+#define BMI090L_WAIT_POLL                            UINT8_C(0x01)
+
+/**\name    Back-off between status polls with BMI090L_WAIT_POLL, doubled after each poll */
+#define BMI090L_POLL_BACKOFF_MIN_US                  UINT16_C(250)
+#define BMI090L_POLL_BACKOFF_MAX_US                  UINT16_C(4000)
+
+/**\name    Data ready polling of the sample ring APIs: poll period and the time to wait for
+ * one sample, above the slowest output data rate of both sensors */
+#ifndef BMI090L_SAMPLE_POLL_US
+#define BMI090L_SAMPLE_POLL_US                       UINT32_C(100)
+#endif
+#ifndef BMI090L_SAMPLE_TIMEOUT_US
+#define BMI090L_SAMPLE_TIMEOUT_US                    UINT32_C(100000)
+#endif
+
+/**\name    Units of the data conversion APIs */
+#define BMI090L_UNIT_G                               UINT8_C(0x00)
+#define BMI090L_UNIT_MPS2                            UINT8_C(0x01)
+#define BMI090L_UNIT_DPS                             UINT8_C(0x02)
+#define BMI090L_UNIT_RPS                             UINT8_C(0x03)
+
+/**\name    Data conversion constants, the full scale doubles with every accel range
+ * step and halves with every gyro range step */
+#define BMI090L_HALF_SCALE                           INT32_C(32768)
+#define BMI090L_ACCEL_FULL_SCALE_G                   INT32_C(3)
+#define BMI090L_GYRO_FULL_SCALE_DPS                  INT32_C(2000)
+#define BMI090L_GRAVITY_EARTH                        (9.80665f)
+#define BMI090L_DEG_TO_RAD                           (0.0174532925f)
+
+/**\name    Full scale of the 3G accel and 2000 dps gyro range in Q16.16 */
+#define BMI090L_ACCEL_FULL_SCALE_MPS2_Q16            INT32_C(1928066)
+#define BMI090L_GYRO_FULL_SCALE_RPS_Q16              INT32_C(2287638)
+
+/**\name    Optional steps of the non-blocking initialization, the chip ID check always runs */
+#define BMI090L_INIT_SOFT_RESET                      UINT8_C(0x01)
+#define BMI090L_INIT_CONFIG_FILE                     UINT8_C(0x02)
+#define BMI090L_INIT_POWER_MODE                      UINT8_C(0x04)
+
+/**\name    States of the non-blocking initialization */
+#define BMI090L_INIT_STATE_START                     UINT8_C(0x00)
+#define BMI090L_INIT_STATE_RESET                     UINT8_C(0x01)
+#define BMI090L_INIT_STATE_RESET_WAIT                UINT8_C(0x02)
+#define BMI090L_INIT_STATE_CONFIG                    UINT8_C(0x03)
+#define BMI090L_INIT_STATE_CONFIG_STREAM             UINT8_C(0x04)
+#define BMI090L_INIT_STATE_CONFIG_WAIT               UINT8_C(0x05)
+#define BMI090L_INIT_STATE_POWER                     UINT8_C(0x06)
+#define BMI090L_INIT_STATE_POWER_CTRL                UINT8_C(0x07)
+#define BMI090L_INIT_STATE_POWER_WAIT                UINT8_C(0x08)
+#define BMI090L_INIT_STATE_DONE                      UINT8_C(0x09)
+
+/**\name    Vectored transfer segment direction */
+#define BMI090L_XFER_READ                            UINT8_C(0x00)
+#define BMI090L_XFER_WRITE                           UINT8_C(0x01)
+
+/**\name    Vectored transfer limits: segments per batch and staged read length */
+#define BMI090L_XFER_MAX_SEGS                        UINT8_C(8)
+#define BMI090L_XFER_STAGE_LEN                       UINT8_C(8)
+
+/**\name    Shadow register cache: number of cached accel and gyro configuration registers */
+#define BMI090L_SHADOW_ACCEL_LEN                     UINT8_C(15)
+#define BMI090L_SHADOW_GYRO_LEN                      UINT8_C(9)
+
+#ifdef BMI090L_BUS_STATS
+/**\name    Bus statistics API identifiers, bus traffic outside of any API is counted as BMI090L_STATS_API_OTHER */
+#define BMI090L_STATS_API_OTHER                      UINT8_C(0)
+#define BMI090L_STATS_API_BMI090LA_INIT              UINT8_C(1)
+#define BMI090L_STATS_API_BMI090LA_APPLY_CONFIG_FILE UINT8_C(2)
+#define BMI090L_STATS_API_BMI090LA_WRITE_FEATURE_CONFIG UINT8_C(3)
+#define BMI090L_STATS_API_BMI090LA_GET_REGS          UINT8_C(4)
+#define BMI090L_STATS_API_BMI090LA_SET_REGS          UINT8_C(5)
+#define BMI090L_STATS_API_BMI090LA_GET_ERROR_STATUS  UINT8_C(6)
+#define BMI090L_STATS_API_BMI090LA_GET_STATUS        UINT8_C(7)
+#define BMI090L_STATS_API_BMI090LA_SOFT_RESET        UINT8_C(8)
+#define BMI090L_STATS_API_BMI090LA_GET_MEAS_CONF     UINT8_C(9)
+#define BMI090L_STATS_API_BMI090LA_SET_MEAS_CONF     UINT8_C(10)
+#define BMI090L_STATS_API_BMI090LA_GET_POWER_MODE    UINT8_C(11)
+#define BMI090L_STATS_API_BMI090LA_SET_POWER_MODE    UINT8_C(12)
+#define BMI090L_STATS_API_BMI090LA_GET_DATA          UINT8_C(13)
+#define BMI090L_STATS_API_BMI090LA_SET_INT_CONFIG    UINT8_C(14)
+#define BMI090L_STATS_API_BMI090LA_GET_SENSOR_TEMPERATURE UINT8_C(15)
+#define BMI090L_STATS_API_BMI090LA_GET_SENSOR_TIME   UINT8_C(16)
+#define BMI090L_STATS_API_BMI090LA_PERFORM_SELFTEST  UINT8_C(17)
+#define BMI090L_STATS_API_BMI090LA_SET_FIFO_CONFIG   UINT8_C(18)
+#define BMI090L_STATS_API_BMI090LA_GET_FIFO_CONFIG   UINT8_C(19)
+#define BMI090L_STATS_API_BMI090LA_READ_FIFO_DATA    UINT8_C(20)
+#define BMI090L_STATS_API_BMI090LA_FIFO_READ_START   UINT8_C(21)
+#define BMI090L_STATS_API_BMI090LA_GET_FIFO_LENGTH   UINT8_C(22)
+#define BMI090L_STATS_API_BMI090LA_GET_FIFO_WM       UINT8_C(23)
+#define BMI090L_STATS_API_BMI090LA_SET_FIFO_WM       UINT8_C(24)
+#define BMI090L_STATS_API_BMI090LA_GET_FIFO_DOWN_SAMPLE UINT8_C(25)
+#define BMI090L_STATS_API_BMI090LA_SET_FIFO_DOWN_SAMPLE UINT8_C(26)
+#define BMI090L_STATS_API_BMI090LA_CONFIGURE_DATA_SYNCHRONIZATION UINT8_C(27)
+#define BMI090L_STATS_API_BMI090LA_CONFIGURE_ANYMOTION UINT8_C(28)
+#define BMI090L_STATS_API_BMI090LA_GET_SYNCHRONIZED_DATA UINT8_C(29)
+#define BMI090L_STATS_API_BMI090LA_SET_DATA_SYNC_INT_CONFIG UINT8_C(30)
+#define BMI090L_STATS_API_BMI090LA_GET_DATA_INT_STATUS UINT8_C(31)
+#define BMI090L_STATS_API_BMI090LA_SET_HIGH_G_CONFIG UINT8_C(32)
+#define BMI090L_STATS_API_BMI090LA_GET_HIGH_G_CONFIG UINT8_C(33)
+#define BMI090L_STATS_API_BMI090LA_SET_LOW_G_CONFIG  UINT8_C(34)
+#define BMI090L_STATS_API_BMI090LA_GET_LOW_G_CONFIG  UINT8_C(35)
+#define BMI090L_STATS_API_BMI090LA_SET_ORIENT_CONFIG UINT8_C(36)
+#define BMI090L_STATS_API_BMI090LA_GET_ORIENT_CONFIG UINT8_C(37)
+#define BMI090L_STATS_API_BMI090LA_SET_NO_MOTION_CONFIG UINT8_C(38)
+#define BMI090L_STATS_API_BMI090LA_GET_NO_MOTION_CONFIG UINT8_C(39)
+#define BMI090L_STATS_API_BMI090LA_GET_ORIENT_OUTPUT UINT8_C(40)
+#define BMI090L_STATS_API_BMI090LA_GET_HIGH_G_OUTPUT UINT8_C(41)
+#define BMI090L_STATS_API_BMI090LA_GET_FEAT_INT_STATUS UINT8_C(42)
+#define BMI090L_STATS_API_BMI090LA_GET_REMAP_AXES    UINT8_C(43)
+#define BMI090L_STATS_API_BMI090LA_SET_REMAP_AXES    UINT8_C(44)
+#define BMI090L_STATS_API_BMI090LA_GET_VERSION_CONFIG UINT8_C(45)
+#define BMI090L_STATS_API_BMI090LG_INIT              UINT8_C(46)
+#define BMI090L_STATS_API_BMI090LG_GET_REGS          UINT8_C(47)
+#define BMI090L_STATS_API_BMI090LG_SET_REGS          UINT8_C(48)
+#define BMI090L_STATS_API_BMI090LG_SOFT_RESET        UINT8_C(49)
+#define BMI090L_STATS_API_BMI090LG_GET_MEAS_CONF     UINT8_C(50)
+#define BMI090L_STATS_API_BMI090LG_SET_MEAS_CONF     UINT8_C(51)
+#define BMI090L_STATS_API_BMI090LG_GET_POWER_MODE    UINT8_C(52)
+#define BMI090L_STATS_API_BMI090LG_SET_POWER_MODE    UINT8_C(53)
+#define BMI090L_STATS_API_BMI090LG_GET_DATA          UINT8_C(54)
+#define BMI090L_STATS_API_BMI090LG_SET_INT_CONFIG    UINT8_C(55)
+#define BMI090L_STATS_API_BMI090LG_PERFORM_SELFTEST  UINT8_C(56)
+#define BMI090L_STATS_API_BMI090LG_GET_DATA_INT_STATUS UINT8_C(57)
+#define BMI090L_STATS_API_BMI090LG_GET_FIFO_OVERRUN  UINT8_C(58)
+#define BMI090L_STATS_API_BMI090LG_GET_FIFO_CONFIG   UINT8_C(59)
+#define BMI090L_STATS_API_BMI090LG_SET_FIFO_CONFIG   UINT8_C(60)
+#define BMI090L_STATS_API_BMI090LG_READ_FIFO_DATA    UINT8_C(61)
+#define BMI090L_STATS_API_BMI090LG_FIFO_READ_START   UINT8_C(62)
+#define BMI090L_STATS_API_BMI090LG_ENABLE_WATERMARK  UINT8_C(63)
+#define BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_BEGIN  UINT8_C(64)
+#define BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_COMMIT UINT8_C(65)
+#define BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_ABORT  UINT8_C(66)
+#define BMI090L_STATS_API_BMI090LA_WARM_APPLY_CONFIG_FILE UINT8_C(67)
+#define BMI090L_STATS_API_BMI090LA_INIT_START        UINT8_C(68)
+#define BMI090L_STATS_API_BMI090LA_INIT_STEP         UINT8_C(69)
+#define BMI090L_STATS_API_BMI090LG_INIT_START        UINT8_C(70)
+#define BMI090L_STATS_API_BMI090LG_INIT_STEP         UINT8_C(71)
+#define BMI090L_STATS_API_BMI090LA_GET_DATA_WITH_TIME UINT8_C(72)
+#define BMI090L_STATS_API_BMI090LA_GET_SYNCHRONIZED_DATA_STATUS UINT8_C(73)
+#define BMI090L_STATS_API_BMI090LA_POLL_SAMPLES      UINT8_C(74)
+#define BMI090L_STATS_API_BMI090LG_POLL_SAMPLES      UINT8_C(75)
+#define BMI090L_STATS_API_BMI090LA_EXTRACT_ACCEL_TIME UINT8_C(76)
+#define BMI090L_STATS_API_BMI090LA_UPDATE_FIFO_WM   UINT8_C(77)
+#define BMI090L_STATS_API_BMI090LA_DRAIN_FIFO       UINT8_C(78)
+#define BMI090L_STATS_API_BMI090LG_DRAIN_FIFO       UINT8_C(79)
+#define BMI090L_STATS_API_BMI090LA_FIFO_WM_CTRL_INIT UINT8_C(80)
+#define BMI090L_STATS_API_MAX                        UINT8_C(81)
+
+/**\name    Bus statistics latency histogram buckets, bucket n counts calls of [2^(n-1), 2^n) us */
+#define BMI090L_STATS_LAT_BUCKETS                    UINT8_C(16)
+#endif
+
 /**\name API success code */
 #define BMI090L_OK                                   INT8_C(0)
 
@@ -594,6 +766,7 @@
 #define BMI090L_E_FEATURE_NOT_SUPPORTED              INT8_C(-9)
 #define BMI090L_E_SELF_TEST                          INT8_C(-10)
 #define BMI090L_E_REMAP_ERROR                        INT8_C(-11)
+#define BMI090L_E_BUSY                               INT8_C(-12)
 
 /***\name    Soft-reset Value */
 #define BMI090L_SOFT_RESET_CMD                       UINT8_C(0xB6)
@@ -606,6 +779,12 @@
 #define BMI090L_W_FIFO_EMPTY                         INT8_C(1)
 #define BMI090L_W_PARTIAL_READ                       INT8_C(2)
 
+/*! @name To define warnings for the non-blocking initialization */
+#define BMI090L_W_IN_PROGRESS                        INT8_C(3)
+
+/*! @name To define warnings for FIFO sample timestamps */
+#define BMI090L_W_NO_SENSOR_TIME                     INT8_C(4)
+
 /**\name    Constant values macros */
 #define BMI090L_SELF_TEST_DELAY_MS                   UINT8_C(3)
 #define BMI090L_POWER_CONFIG_DELAY                   UINT8_C(5)
@@ -663,6 +842,67 @@
 #define BMI090L_FIFO_SKIP_FRM_LENGTH                 UINT8_C(1)
 #define BMI090L_FIFO_INPUT_CFG_LENGTH                UINT8_C(1)
 
+/*! @name Longest accel FIFO frame, header and accel data */
+#define BMI090L_FIFO_MAX_FRAME_LENGTH                UINT8_C(7)
+
+/*! @name Types of accel FIFO events */
+#define BMI090L_FIFO_EVENT_ACCEL                     UINT8_C(0)
+#define BMI090L_FIFO_EVENT_SENSOR_TIME               UINT8_C(1)
+#define BMI090L_FIFO_EVENT_SKIP                      UINT8_C(2)
+#define BMI090L_FIFO_EVENT_INPUT_CFG                 UINT8_C(3)
+#define BMI090L_FIFO_EVENT_SAMPLE_DROP               UINT8_C(4)
+
+/*! @name Sensor time counter mask and ticks per sample at 1600 Hz ODR */
+#define BMI090L_SENSOR_TIME_MASK                     UINT32_C(0x00FFFFFF)
+#define BMI090L_SENSOR_TIME_1600_HZ_TICKS            UINT8_C(16)
+
+/*! @name Sensor time tick, 39062.5 ns, as a fraction */
+#define BMI090L_SENSOR_TIME_TICK_NS_NUM              UINT32_C(78125)
+#define BMI090L_SENSOR_TIME_TICK_NS_DEN              UINT32_C(2)
+
+/*! @name Sensors of merged FIFO samples */
+#define BMI090L_FIFO_SAMPLE_ACCEL                    UINT8_C(0)
+#define BMI090L_FIFO_SAMPLE_GYRO                     UINT8_C(1)
+
+/**\name    Gyro sample time tracking of the FIFO merger: divider of the time and
+ * the period correction, and the time error in periods that restarts tracking */
+#ifndef BMI090L_GYRO_TIME_GAIN
+#define BMI090L_GYRO_TIME_GAIN                       INT64_C(16)
+#endif
+#ifndef BMI090L_GYRO_PERIOD_GAIN
+#define BMI090L_GYRO_PERIOD_GAIN                     INT64_C(256)
+#endif
+#ifndef BMI090L_GYRO_TIME_RESYNC
+#define BMI090L_GYRO_TIME_RESYNC                     INT64_C(4)
+#endif
+
+/**\name    Grid points one sensor may run ahead of the other in the FIFO resampler */
+#ifndef BMI090L_FIFO_RESAMPLE_DEPTH
+#define BMI090L_FIFO_RESAMPLE_DEPTH                  UINT8_C(32)
+#endif
+
+/*! @name Accel FIFO drain modes */
+#define BMI090L_FIFO_DRAIN_EXACT                     UINT8_C(0)
+#define BMI090L_FIFO_DRAIN_OVER_READ                 UINT8_C(1)
+
+/*! @name FIFO capacities, accel in bytes and gyro in frames */
+#define BMI090L_ACCEL_FIFO_SIZE                      UINT16_C(1024)
+#define BMI090L_GYRO_FIFO_MAX_FRAMES                 UINT8_C(100)
+
+/**\name    FIFO watermark controller: latency margin on top of the measured latency,
+ * for the FIFO read itself, the decay of the latency peak per update, as a
+ * shift, and the watermark change, as a shift of the FIFO capacity, below
+ * which a watermark is not raised */
+#ifndef BMI090L_FIFO_WM_MARGIN_US
+#define BMI090L_FIFO_WM_MARGIN_US                    UINT32_C(1000)
+#endif
+#ifndef BMI090L_FIFO_WM_PEAK_DECAY_SHIFT
+#define BMI090L_FIFO_WM_PEAK_DECAY_SHIFT             UINT8_C(8)
+#endif
+#ifndef BMI090L_FIFO_WM_HYSTERESIS_SHIFT
+#define BMI090L_FIFO_WM_HYSTERESIS_SHIFT             UINT8_C(4)
+#endif
+
 /*! @name FIFO byte counter mask definition */
 #define BMI090L_FIFO_BYTE_COUNTER_MSB_MASK           UINT8_C(0x3F)
 
@@ -689,7 +929,7 @@
 #define BMI090L_ACCEL_INT2_EN_POS                    UINT8_C(2)
 
 /*! @name Position definitions for FIFO_DOWNS register */
-#define BMI090L_ACC_FIFO_DOWNS_MASK                  UINT8_C(0xF0)
+#define BMI090L_ACC_FIFO_DOWNS_MASK                  UINT8_C(0x70)
 
 /*! @name FIFO down sampling bit positions */
 #define BMI090L_ACC_FIFO_DOWNS_POS                   UINT8_C(0x04)
@@ -997,6 +1237,84 @@ typedef BMI090L_INTF_RET_TYPE (*bmi090l_write_fptr_t)(uint8_t reg_addr, const ui
  */
 typedef void (*bmi090l_delay_us_fptr_t)(uint32_t period, void *intf_ptr);
 
+struct bmi090l_xfer_seg;
+
+/*!
+ * @brief Vectored bus communication function pointer, performing a list of
+ * register transactions in a single call of the user
+ *
+ * @param[in,out] seg      : Segments in bus format, to be performed in order
+ * @param[in]     count    : Number of segments
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval 0 for Success
+ * @retval Non-zero for Failure
+ */
+typedef BMI090L_INTF_RET_TYPE (*bmi090l_xfer_fptr_t)(const struct bmi090l_xfer_seg *seg, uint8_t count, void *intf_ptr);
+
+struct bmi090l_fifo_xfer;
+
+/*!
+ * @brief Non-blocking bus read function pointer. The transfer is started and
+ * the function returns; on completion the user calls bmi090la_fifo_read_complete()
+ * or bmi090lg_fifo_read_complete() with the transfer. Completion may be
+ * reported before the function returns.
+ *
+ * @param[in]     reg_addr : 8bit register address of the sensor
+ * @param[out]    reg_data : Data from the specified address, valid on completion
+ * @param[in]     len      : Length of the reg_data array
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @param[in]     xfer     : Transfer to be passed to the completion API
+ * @retval 0 for Success
+ * @retval Non-zero for Failure, the transfer was not started
+ */
+typedef BMI090L_INTF_RET_TYPE (*bmi090l_read_async_fptr_t)(uint8_t reg_addr, uint8_t *reg_data, uint32_t len,
+                                                           void *intf_ptr, struct bmi090l_fifo_xfer *xfer);
+
+/*!
+ * @brief FIFO read completion function pointer
+ *
+ * @param[in] xfer : Completed transfer
+ * @param[in] rslt : Result of the transfer, BMI090L_OK or BMI090L_E_COM_FAIL
+ */
+typedef void (*bmi090l_fifo_done_fptr_t)(struct bmi090l_fifo_xfer *xfer, int8_t rslt);
+
+/*!
+ * @brief Timestamp function pointer used by the sample ring APIs and the bus statistics
+ *
+ * @param[in,out] intf_ptr : Void pointer that can enable the linking of descriptors
+ *                           for interface related callbacks
+ * @retval Free running time in microseconds, wrapping at 2^32
+ */
+typedef uint32_t (*bmi090l_timestamp_us_fptr_t)(void *intf_ptr);
+
+struct bmi090l_sensor_data;
+
+/*!
+ * @brief FIFO visitor function pointer for accel frames
+ *
+ * @param[in] accel : Re-mapped accel sample
+ * @param[in] ctx   : User context given in bmi090l_fifo_visitor.ctx
+ */
+typedef void (*bmi090l_fifo_accel_fptr_t)(const struct bmi090l_sensor_data *accel, void *ctx);
+
+/*!
+ * @brief FIFO visitor function pointer for sensor time frames
+ *
+ * @param[in] sensor_time : 24 bit sensor time
+ * @param[in] ctx         : User context given in bmi090l_fifo_visitor.ctx
+ */
+typedef void (*bmi090l_fifo_time_fptr_t)(uint32_t sensor_time, void *ctx);
+
+/*!
+ * @brief FIFO visitor function pointer for skip, input configuration and sample drop frames
+ *
+ * @param[in] value : Payload byte of the frame
+ * @param[in] ctx   : User context given in bmi090l_fifo_visitor.ctx
+ */
+typedef void (*bmi090l_fifo_byte_fptr_t)(uint8_t value, void *ctx);
+
 /**\name    Structure Definitions */
 
 /*!
@@ -1014,6 +1332,33 @@ struct bmi090l_sensor_data
     int16_t z;
 };
 
+/*!
+ *  @brief Ring of samples in structure-of-arrays layout, the storage is provided by the user
+ */
+struct bmi090l_sample_ring
+{
+    /*! X-axis samples, size entries */
+    int16_t *x;
+
+    /*! Y-axis samples, size entries */
+    int16_t *y;
+
+    /*! Z-axis samples, size entries */
+    int16_t *z;
+
+    /*! Optional timestamps from dev->timestamp_us in microseconds, NULL to skip */
+    uint32_t *time_us;
+
+    /*! Number of entries of each array */
+    uint16_t size;
+
+    /*! Index of the next entry to be written */
+    uint16_t head;
+
+    /*! Number of valid entries, the oldest entry is overwritten once the ring is full */
+    uint16_t count;
+};
+
 /*!
  *  @brief Sensor XYZ data structure in float representation
  */
@@ -1029,6 +1374,21 @@ struct bmi090l_sensor_data_f
     float z;
 };
 
+/*!
+ *  @brief Sensor XYZ data structure in Q16.16 fixed point representation
+ */
+struct bmi090l_sensor_data_q16
+{
+    /*! X-axis sensor data */
+    int32_t x;
+
+    /*! Y-axis sensor data */
+    int32_t y;
+
+    /*! Z-axis sensor data */
+    int32_t z;
+};
+
 /*!
  *  @brief Sensor configuration structure
  */
@@ -1452,6 +1812,351 @@ struct bmi090l_fifo_frame
     struct bmi090l_gyr_fifo_config gyr_fifo_conf;
 };
 
+/*!
+ *  @brief State of the streaming accel FIFO parser, kept between chunks
+ */
+struct bmi090l_fifo_parser
+{
+    /*! Skipped frame count of the last skip frame */
+    uint8_t skipped_frame_count;
+
+    /*! Sensor time of the last sensor time frame */
+    uint32_t sensor_time;
+
+    /*! Start of a frame cut off at the end of the previous chunk */
+    uint8_t partial[BMI090L_FIFO_MAX_FRAME_LENGTH];
+
+    /*! Bytes held in partial */
+    uint8_t partial_len;
+};
+
+/*!
+ *  @brief Callbacks of the accel FIFO visitor, NULL to ignore a frame type
+ */
+struct bmi090l_fifo_visitor
+{
+    /*! Accel frame */
+    bmi090l_fifo_accel_fptr_t accel;
+
+    /*! Sensor time frame */
+    bmi090l_fifo_time_fptr_t sensor_time;
+
+    /*! Skip frame, with the number of skipped frames */
+    bmi090l_fifo_byte_fptr_t skip;
+
+    /*! Input configuration frame */
+    bmi090l_fifo_byte_fptr_t input_cfg;
+
+    /*! Sample drop frame */
+    bmi090l_fifo_byte_fptr_t sample_drop;
+
+    /*! Context passed to the callbacks */
+    void *ctx;
+};
+
+/*!
+ *  @brief Accel FIFO event, one per frame
+ */
+struct bmi090l_fifo_event
+{
+    /*! BMI090L_FIFO_EVENT_* */
+    uint8_t type;
+
+    /*! Payload byte of skip, input configuration and sample drop frames */
+    uint8_t value;
+
+    /*! Re-mapped sample of accel frames */
+    struct bmi090l_sensor_data accel;
+
+    /*! Sensor time of sensor time frames */
+    uint32_t sensor_time;
+};
+
+/*!
+ *  @brief Accel FIFO sample timeline, kept between FIFO reads
+ */
+struct bmi090l_fifo_timeline
+{
+    /*! Last sensor time frame, extended to 64 bit */
+    uint64_t sensor_time;
+
+    /*! Time of the last extracted sample, in sensor time ticks */
+    uint64_t sample_time;
+
+    /*! TRUE once sensor_time and sample_time are set */
+    uint8_t valid;
+
+    /*! FIFO mode, BMI090L_ACC_STREAM_MODE or BMI090L_ACC_FIFO_MODE, as set with
+     * bmi090la_set_fifo_config(). To be set by the user */
+    uint8_t fifo_mode;
+
+    /*! FIFO down-sampling, as set with bmi090la_set_fifo_down_sample(). To be set by the user */
+    uint8_t fifo_downs;
+};
+
+/*!
+ *  @brief Sample of the merged accel and gyro FIFO stream
+ */
+struct bmi090l_fifo_sample
+{
+    /*! Time in ns on the sensor time base */
+    uint64_t time_ns;
+
+    /*! Accel or gyro data */
+    struct bmi090l_sensor_data data;
+
+    /*! BMI090L_FIFO_SAMPLE_ACCEL or BMI090L_FIFO_SAMPLE_GYRO */
+    uint8_t sensor;
+};
+
+/*!
+ *  @brief State of the accel and gyro FIFO merger, kept between FIFO reads
+ */
+struct bmi090l_fifo_merger
+{
+    /*! Accel timeline, passed to bmi090la_extract_accel_time() */
+    struct bmi090l_fifo_timeline accel_timeline;
+
+    /*! Sensor time the gyro time was last corrected with */
+    uint64_t sensor_time;
+
+    /*! Estimated time of the last gyro sample, in ns */
+    uint64_t gyro_time_ns;
+
+    /*! Estimated gyro sample period, in ns */
+    uint32_t gyro_period_ns;
+
+    /*! TRUE once gyro_time_ns and gyro_period_ns are set */
+    uint8_t gyro_valid;
+};
+
+/*!
+ *  @brief State of the FIFO watermark controller
+ */
+struct bmi090l_fifo_wm_ctrl
+{
+    /*! Smoothed service latency, in us */
+    uint32_t latency_us;
+
+    /*! Smoothed deviation of the service latency, in us */
+    uint32_t latency_dev_us;
+
+    /*! Slowly decaying peak of the service latency, in us */
+    uint32_t latency_peak_us;
+
+    /*! Accel watermark in bytes, 0 if the accel FIFO is not controlled */
+    uint16_t accel_wm;
+
+    /*! Gyro watermark in frames, 0 if the gyro FIFO is not controlled */
+    uint8_t gyro_wm;
+
+    /*! Accel FIFO down-sampling, read from the sensor by bmi090la_fifo_wm_ctrl_init() */
+    uint8_t accel_downs;
+
+    /*! TRUE once a latency is measured */
+    uint8_t valid;
+};
+
+/*!
+ *  @brief Accel and gyro sample on a common time grid
+ */
+struct bmi090l_imu_sample
+{
+    /*! Time of the grid point in ns */
+    uint64_t time_ns;
+
+    /*! Accel data */
+    struct bmi090l_sensor_data accel;
+
+    /*! Gyro data */
+    struct bmi090l_sensor_data gyro;
+};
+
+/*!
+ *  @brief State of the FIFO resampler, kept between calls
+ */
+struct bmi090l_fifo_resampler
+{
+    /*! Grid period in ns */
+    uint32_t period_ns;
+
+    /*! Time of the oldest pending grid point */
+    uint64_t time_ns;
+
+    /*! Last accel and gyro sample */
+    struct bmi090l_fifo_sample last[2];
+
+    /*! Interpolated accel and gyro data of the pending grid points */
+    struct bmi090l_sensor_data pending[2][BMI090L_FIFO_RESAMPLE_DEPTH];
+
+    /*! Ring index of the oldest pending grid point */
+    uint8_t head;
+
+    /*! Pending grid points with accel and gyro data */
+    uint8_t fill[2];
+
+    /*! Set bit per sensor with a last sample */
+    uint8_t seen;
+};
+
+/*!
+ *  @brief Asynchronous FIFO read
+ */
+struct bmi090l_fifo_xfer
+{
+    /*! FIFO frame receiving the data, set by the user */
+    struct bmi090l_fifo_frame *fifo;
+
+    /*! Completion callback, set by the user */
+    bmi090l_fifo_done_fptr_t done;
+
+    /*! Context of the completion callback, set by the user */
+    void *done_ctx;
+
+    /*! Device the transfer was started on */
+    struct bmi090l_dev *dev;
+
+    /*! Result of the last transfer */
+    int8_t rslt;
+
+    /*! Transfer in flight */
+    uint8_t busy;
+};
+
+/*!
+ *  @brief Segment of a vectored bus transaction
+ */
+struct bmi090l_xfer_seg
+{
+    /*! Register address as sent on the bus, including the SPI read bit */
+    uint8_t reg_addr;
+
+    /*! BMI090L_XFER_READ or BMI090L_XFER_WRITE */
+    uint8_t dir;
+
+    /*! Data buffer, read data includes the SPI dummy byte of the accel */
+    uint8_t *data;
+
+    /*! Number of bytes on the bus */
+    uint32_t len;
+};
+
+/*!
+ *  @brief Context of the non-blocking initialization of one sensor
+ */
+struct bmi090l_init_ctx
+{
+    /*! Optional steps to run, BMI090L_INIT_* flags */
+    uint8_t steps;
+
+    /*! Current state, BMI090L_INIT_STATE_* */
+    uint8_t state;
+
+    /*! Offset of the next config file chunk */
+    uint16_t index;
+
+    /*! Time waited for the sensor in the current state */
+    uint32_t waited_us;
+
+    /*! Last delay requested while waiting for the sensor, 0 before the first */
+    uint32_t backoff_us;
+};
+
+/*!
+ *  @brief RAM image of the accel feature configuration space
+ */
+struct bmi090l_feature_image
+{
+    /*! Feature configuration words */
+    uint16_t word[BMI090L_FEATURE_WORDS];
+
+    /*! Dirty bit per word, cleared once written to the sensor */
+    uint16_t dirty;
+
+    /*! Image matches the sensor */
+    uint8_t valid;
+
+    /*! Feature config transaction open, writes are held in the image until commit */
+    uint8_t staged;
+};
+
+/*!
+ *  @brief Write-through cache of the configuration registers
+ */
+struct bmi090l_shadow
+{
+    /*! Enable the cache, set by the user after bmi090l_set_dev_defaults() and before
+     * bmi090la_init() and bmi090lg_init() */
+    uint8_t enable;
+
+    /*! Valid bit per cached accel register */
+    uint16_t accel_valid;
+
+    /*! Valid bit per cached gyro register */
+    uint16_t gyro_valid;
+
+    /*! Accel ACC_CONF, ACC_RANGE, FIFO_DOWNS to FIFO_CONFIG_1, INT1_IO_CONF to
+     * INT1_INT2_MAP_DATA, PWR_CONF and PWR_CTRL */
+    uint8_t accel[BMI090L_SHADOW_ACCEL_LEN];
+
+    /*! Gyro RANGE, BANDWIDTH, LPM1, INT_CTRL, INT3_INT4_IO_CONF, INT3_INT4_IO_MAP,
+     * FIFO_WM_ENABLE, FIFO_CONFIG_0 and FIFO_CONFIG_1 */
+    uint8_t gyro[BMI090L_SHADOW_GYRO_LEN];
+};
+
+#ifdef BMI090L_BUS_STATS
+
+/*!
+ *  @brief Bus statistics of one API
+ */
+struct bmi090l_api_stats
+{
+    /*! Number of calls */
+    uint32_t calls;
+
+    /*! Number of read transactions */
+    uint32_t read_txns;
+
+    /*! Number of write transactions */
+    uint32_t write_txns;
+
+    /*! Number of vectored transactions through dev->xfer, counted once per call
+     * whatever its segments; their bytes are added to read_bytes and write_bytes */
+    uint32_t xfer_txns;
+
+    /*! Bytes read, including the SPI dummy byte */
+    uint32_t read_bytes;
+
+    /*! Bytes written */
+    uint32_t write_bytes;
+
+    /*! Longest call in microseconds */
+    uint32_t max_us;
+
+    /*! Call latency histogram, bucket 0 counts calls below 1 us and
+     * bucket n counts calls of [2^(n-1), 2^n) us, the last bucket is open ended */
+    uint32_t lat_hist[BMI090L_STATS_LAT_BUCKETS];
+};
+
+/*!
+ *  @brief Bus statistics of a device, indexed by BMI090L_STATS_API_*
+ */
+struct bmi090l_bus_stats
+{
+    /*! Statistics per API */
+    struct bmi090l_api_stats api[BMI090L_STATS_API_MAX];
+
+    /*! API the current bus traffic is counted against */
+    uint8_t cur_api;
+
+    /*! Nesting depth of API calls, nested calls count against the outermost API */
+    uint8_t depth;
+
+    /*! Timestamp of the outermost API call */
+    uint32_t start_us;
+};
+#endif
+
 /*!
  *  @brief
  *  This structure holds all relevant information about BMI09
@@ -1479,6 +2184,21 @@ struct bmi090l_dev
     /*! Decide SPI or I2C read mechanism */
     uint8_t dummy_byte;
 
+    /*! Opt-in for the optional members (dummy_byte_mode, xfer, read_async, wait_mode,
+     * shadow, feature, stats and timestamp_us). Unless it holds BMI090L_DEV_EXT_KEY,
+     * bmi090la_init(), bmi090lg_init() and their _init_start() variants reset the
+     * optional members to their defaults and set the key, so a structure filled in
+     * as for earlier releases runs with the optional features off. To set optional
+     * members before init, call bmi090l_set_dev_defaults() first */
+    uint32_t ext_key;
+
+    /*! Handling of the SPI dummy byte on accel reads, BMI090L_DUMMY_BYTE_COPY by default.
+     * With BMI090L_DUMMY_BYTE_HEADROOM, bmi090la_read_fifo_data() keeps the dummy byte
+     * at data[0] of the FIFO buffer and parsing starts at acc_byte_start_idx.
+     * With BMI090L_DUMMY_BYTE_INTF, the read callback must not return the dummy byte.
+     * Optional, see ext_key */
+    uint8_t dummy_byte_mode;
+
     /*! Structure to configure accel sensor  */
     struct bmi090l_cfg accel_cfg;
 
@@ -1504,6 +2224,40 @@ struct bmi090l_dev
     /*! Delay function pointer */
     bmi090l_delay_us_fptr_t delay_us;
 
+    /*! Optional vectored read/write function pointer, NULL to use read and write */
+    bmi090l_xfer_fptr_t xfer;
+
+    /*! Optional non-blocking read function pointer, used by the asynchronous FIFO APIs */
+    bmi090l_read_async_fptr_t read_async;
+
+    /*! Cached accel FIFO enable bit, BMI090L_FIFO_EN_UNKNOWN until known */
+    uint8_t accel_fifo_en;
+
+    /*! BMI090L_WAIT_FIXED (default) sleeps the worst-case time after resets, config
+     * load and power mode switches. BMI090L_WAIT_POLL polls the status registers and
+     * returns once the sensor is ready, bounded by the same worst-case time */
+    uint8_t wait_mode;
+
+    /*! Shadow of the configuration registers. With shadow.enable set, register
+     * reads are answered from RAM once known and writes go through to the sensor.
+     * The cache is filled at init and refilled after a soft reset; clear the valid
+     * bits if the registers are changed outside of this driver */
+    struct bmi090l_shadow shadow;
+
+    /*! Image of the feature configuration space, loaded on first use and
+     * dropped on soft reset, config file upload or a direct feature space write */
+    struct bmi090l_feature_image feature;
+
+#ifdef BMI090L_BUS_STATS
+
+    /*! Optional bus statistics, NULL to disable counting */
+    struct bmi090l_bus_stats *stats;
+#endif
+
+    /*! Optional timestamp function pointer, used for the sample ring timestamps and
+     * the latency histograms of the bus statistics */
+    bmi090l_timestamp_us_fptr_t timestamp_us;
+
     /*! Variable to store result of read/write function */
     BMI090L_INTF_RET_TYPE intf_rslt;
 };
@@ -0,0 +1,1738 @@
+/**
+* Copyright (c) 2021 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bmi090l_sim.c
+* @date       2021-04-15
+* @version    v1.1.6
+*
+*/
+
+/*! \file bmi090l_sim.c
+ * \brief Register level software model of the BMI090L */
+
+/****************************************************************************/
+
+/**\name        Header files
+ ****************************************************************************/
+#include <string.h>
+
+#include "bmi090l.h"
+#include "bmi090l_sim.h"
+
+/****************************************************************************/
+
+/** \name       Macros
+ ****************************************************************************/
+
+/**\name    Sensor time runs at 25.6 kHz, one tick is 10^7 / 256 ns */
+#define SIM_NS_PER_TICK_NUM     UINT64_C(10000000)
+#define SIM_NS_PER_TICK_DEN     UINT64_C(256)
+#define SIM_SENSOR_TIME_MASK    UINT32_C(0xFFFFFF)
+
+/**\name    Accel register reset values */
+#define SIM_ACCEL_CONF_RESET    UINT8_C(0xA8)
+#define SIM_ACCEL_RANGE_RESET   UINT8_C(0x01)
+#define SIM_FIFO_DOWNS_RESET    UINT8_C(0x80)
+#define SIM_FIFO_DOWNS_MASK     UINT8_C(0x07)
+#define SIM_FIFO_WTM_1_RESET    UINT8_C(0x02)
+#define SIM_FIFO_CONFIG_0_RESET UINT8_C(0x02)
+#define SIM_FIFO_CONFIG_1_RESET UINT8_C(0x10)
+#define SIM_PWR_CONF_RESET      UINT8_C(0x03)
+
+/**\name    Accel commands and status values */
+#define SIM_ACCEL_FIFO_FLUSH    UINT8_C(0xB0)
+#define SIM_ACCEL_APS_MASK      UINT8_C(0x01)
+#define SIM_INTERNAL_NOT_INIT   UINT8_C(0x00)
+#define SIM_INTERNAL_INIT_ERR   UINT8_C(0x02)
+
+/**\name    Feature memory layout */
+#define SIM_FEATURE_SYNC_BYTE   UINT8_C(0x04)
+#define SIM_FEATURE_REMAP_RESET UINT8_C(0x88)
+
+/**\name    Gyro register reset values */
+#define SIM_GYRO_IO_CONF_RESET  UINT8_C(0x0F)
+#define SIM_GYRO_SELF_TEST_TRIG UINT8_C(0x01)
+#define SIM_GYRO_SELF_TEST_DONE UINT8_C(0x12)
+
+/**\name    Temperature register reset values (25 degree Celsius) */
+#define SIM_TEMP_MSB_RESET      UINT8_C(0x02)
+#define SIM_TEMP_LSB_RESET      UINT8_C(0x00)
+
+/**\name    Self-test excitation in mg */
+#define SIM_SELF_TEST_XY_MG     INT32_C(1200)
+#define SIM_SELF_TEST_Z_MG      INT32_C(600)
+
+/**\name    Default bus timing */
+#define SIM_SPI_OVERHEAD_NS     UINT32_C(1000)
+#define SIM_SPI_BYTE_NS         UINT32_C(800)
+#define SIM_I2C_OVERHEAD_NS     UINT32_C(50000)
+#define SIM_I2C_BYTE_NS         UINT32_C(22500)
+
+/**\name    Bus callback failure */
+#define SIM_INTF_FAIL           ((BMI090L_INTF_RET_TYPE) - 1)
+
+/****************************************************************************/
+
+/*! Static Function Declarations
+ ****************************************************************************/
+
+/*!
+ * @brief This internal API converts virtual time to sensor time ticks.
+ *
+ * @param[in] time_ns : Virtual time in nanoseconds.
+ *
+ * @return Sensor time ticks, not truncated to 24 bit
+ */
+static uint64_t ns_to_ticks(uint64_t time_ns);
+
+/*!
+ * @brief This internal API converts sensor time ticks to virtual time.
+ *
+ * @param[in] ticks : Sensor time ticks.
+ *
+ * @return Virtual time in nanoseconds
+ */
+static uint64_t ticks_to_ns(uint64_t ticks);
+
+/*!
+ * @brief This internal API advances the virtual clock and brings the model
+ * up to date.
+ *
+ * @param[in,out] sim     : Simulator instance.
+ * @param[in]     time_ns : Time to add in nanoseconds.
+ */
+static void advance(struct bmi090l_sim *sim, uint64_t time_ns);
+
+/*!
+ * @brief This internal API produces all samples and events due until the
+ * current virtual time.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void update(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns a sample of the given sensor.
+ *
+ * @param[in]  sim     : Simulator instance.
+ * @param[in]  sensor  : BMI090L_SIM_ACCEL or BMI090L_SIM_GYRO.
+ * @param[in]  time_ns : Time of the sample.
+ * @param[out] data    : Sample.
+ */
+static void get_sample(const struct bmi090l_sim *sim,
+                       uint8_t sensor,
+                       uint64_t time_ns,
+                       struct bmi090l_sensor_data *data);
+
+/*!
+ * @brief This internal API stores a 16 bit value little endian.
+ *
+ * @param[out] buf   : Destination.
+ * @param[in]  value : Value to store.
+ */
+static void put_le16(uint8_t *buf, int16_t value);
+
+/*!
+ * @brief This internal API resets the accel to its power-on state.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void accel_reset(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns the accel sample period in sensor time ticks.
+ *
+ * @param[in] sim : Simulator instance.
+ *
+ * @return Sample period in ticks
+ */
+static uint32_t accel_period_ticks(const struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API aligns the accel sampling clock to the first
+ * sample at or after the given time.
+ *
+ * @param[in,out] sim      : Simulator instance.
+ * @param[in]     start_ns : Earliest time of the next sample.
+ */
+static void accel_restart_clock(struct bmi090l_sim *sim, uint64_t start_ns);
+
+/*!
+ * @brief This internal API takes an accel sample at the given tick.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     tick : Sensor time tick of the sample.
+ */
+static void accel_take_sample(struct bmi090l_sim *sim, uint64_t tick);
+
+/*!
+ * @brief This internal API updates the data synchronization registers.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void accel_update_sync(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns the length of an accel FIFO frame.
+ *
+ * @param[in] header : Frame header.
+ *
+ * @return Frame length in bytes, including the header
+ */
+static uint8_t accel_frame_length(uint8_t header);
+
+/*!
+ * @brief This internal API appends a frame to the accel FIFO, honouring the
+ * stream and FIFO modes.
+ *
+ * @param[in,out] sim   : Simulator instance.
+ * @param[in]     frame : Frame bytes.
+ * @param[in]     len   : Frame length.
+ */
+static void accel_fifo_push(struct bmi090l_sim *sim, const uint8_t *frame, uint8_t len);
+
+/*!
+ * @brief This internal API appends bytes to the accel FIFO ring.
+ *
+ * @param[in,out] sim   : Simulator instance.
+ * @param[in]     frame : Frame bytes.
+ * @param[in]     len   : Frame length.
+ */
+static void accel_fifo_append(struct bmi090l_sim *sim, const uint8_t *frame, uint8_t len);
+
+/*!
+ * @brief This internal API drops the oldest accel FIFO frame.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void accel_fifo_drop(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API clears the accel FIFO.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void accel_fifo_flush(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns the next byte of the accel FIFO data register.
+ *
+ * @param[in,out] sim : Simulator instance.
+ *
+ * @return FIFO byte
+ */
+static uint8_t accel_fifo_read(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API reads one accel register.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     addr : Register address.
+ *
+ * @return Register value
+ */
+static uint8_t accel_read_reg(struct bmi090l_sim *sim, uint8_t addr);
+
+/*!
+ * @brief This internal API writes one accel register.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     addr : Register address.
+ * @param[in]     data : Register value.
+ */
+static void accel_write_reg(struct bmi090l_sim *sim, uint8_t addr, uint8_t data);
+
+/*!
+ * @brief This internal API handles a write to the feature configuration window.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     data : Written byte.
+ */
+static void accel_write_feature(struct bmi090l_sim *sim, uint8_t data);
+
+/*!
+ * @brief This internal API starts the initialization of the uploaded config.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void accel_start_init(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API resets the gyro to its power-on state.
+ *
+ * @param[in,out] sim : Simulator instance.
+ */
+static void gyro_reset(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns the gyro sample period.
+ *
+ * @param[in] sim : Simulator instance.
+ *
+ * @return Sample period in nanoseconds
+ */
+static uint64_t gyro_period_ns(const struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API takes a gyro sample.
+ *
+ * @param[in,out] sim     : Simulator instance.
+ * @param[in]     time_ns : Time of the sample.
+ */
+static void gyro_take_sample(struct bmi090l_sim *sim, uint64_t time_ns);
+
+/*!
+ * @brief This internal API returns the size of a gyro FIFO frame for the
+ * current FIFO configuration.
+ *
+ * @param[in] sim : Simulator instance.
+ *
+ * @return Frame size in bytes
+ */
+static uint8_t gyro_frame_size(const struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API returns the next byte of the gyro FIFO data register.
+ *
+ * @param[in,out] sim : Simulator instance.
+ *
+ * @return FIFO byte
+ */
+static uint8_t gyro_fifo_read(struct bmi090l_sim *sim);
+
+/*!
+ * @brief This internal API reads one gyro register.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     addr : Register address.
+ *
+ * @return Register value
+ */
+static uint8_t gyro_read_reg(struct bmi090l_sim *sim, uint8_t addr);
+
+/*!
+ * @brief This internal API writes one gyro register.
+ *
+ * @param[in,out] sim  : Simulator instance.
+ * @param[in]     addr : Register address.
+ * @param[in]     data : Register value.
+ */
+static void gyro_write_reg(struct bmi090l_sim *sim, uint8_t addr, uint8_t data);
+
+/*!
+ * @brief This internal API performs a burst read on the accel.
+ *
+ * @param[in,out] sim      : Simulator instance.
+ * @param[in]     reg_addr : Register address without SPI read bit.
+ * @param[out]    reg_data : Data read.
+ * @param[in]     len      : Number of bytes on the bus.
+ */
+static void accel_read(struct bmi090l_sim *sim, uint8_t reg_addr, uint8_t *reg_data, uint32_t len);
+
+/*!
+ * @brief This internal API performs a burst read on the gyro.
+ *
+ * @param[in,out] sim      : Simulator instance.
+ * @param[in]     reg_addr : Register address without SPI read bit.
+ * @param[out]    reg_data : Data read.
+ * @param[in]     len      : Number of bytes on the bus.
+ */
+static void gyro_read(struct bmi090l_sim *sim, uint8_t reg_addr, uint8_t *reg_data, uint32_t len);
+
+/*!
+ * @brief This internal API performs one read transaction on the bus, charging
+ * the byte time but not the transaction overhead.
+ *
+ * @param[in] port      : Addressed port.
+ * @param[in] reg_addr  : Register address as sent on the bus.
+ * @param[out] reg_data : Data read.
+ * @param[in] len       : Number of bytes on the bus.
+ *
+ * @return Result of the bus transaction
+ */
+static BMI090L_INTF_RET_TYPE bus_read(const struct bmi090l_sim_port *port,
+                                      uint8_t reg_addr,
+                                      uint8_t *reg_data,
+                                      uint32_t len);
+
+/*!
+ * @brief This internal API performs one write transaction on the bus, charging
+ * the byte time but not the transaction overhead.
+ *
+ * @param[in] port     : Addressed port.
+ * @param[in] reg_addr : Register address as sent on the bus.
+ * @param[in] reg_data : Data to write.
+ * @param[in] len      : Number of bytes on the bus.
+ *
+ * @return Result of the bus transaction
+ */
+static BMI090L_INTF_RET_TYPE bus_write(const struct bmi090l_sim_port *port,
+                                       uint8_t reg_addr,
+                                       const uint8_t *reg_data,
+                                       uint32_t len);
+
+/****************************************************************************/
+
+/**\name        Function definitions
+ ****************************************************************************/
+
+/*!
+ *  @brief This API puts the simulated accel and gyro in their power-on state.
+ */
+void bmi090l_sim_init(struct bmi090l_sim *sim, enum bmi090l_intf intf)
+{
+    if (sim != NULL)
+    {
+        (void)memset(sim, 0, sizeof(*sim));
+
+        sim->accel_port.sim = sim;
+        sim->accel_port.sensor = BMI090L_SIM_ACCEL;
+        sim->gyro_port.sim = sim;
+        sim->gyro_port.sensor = BMI090L_SIM_GYRO;
+        sim->intf = intf;
+
+        if (intf == BMI090L_SPI_INTF)
+        {
+            sim->xfer_overhead_ns = SIM_SPI_OVERHEAD_NS;
+            sim->xfer_byte_ns = SIM_SPI_BYTE_NS;
+        }
+        else
+        {
+            sim->xfer_overhead_ns = SIM_I2C_OVERHEAD_NS;
+            sim->xfer_byte_ns = SIM_I2C_BYTE_NS;
+        }
+
+        sim->accel_boot_us = BMI090L_SIM_ACCEL_BOOT_US;
+        sim->accel_startup_us = BMI090L_SIM_ACCEL_STARTUP_US;
+        sim->gyro_boot_us = BMI090L_SIM_GYRO_BOOT_US;
+        sim->gyro_startup_us = BMI090L_SIM_GYRO_STARTUP_US;
+        sim->asic_init_us = BMI090L_SIM_ASIC_INIT_US;
+
+        accel_reset(sim);
+        gyro_reset(sim);
+
+        /* Power-on reset does not need the boot time of a soft-reset */
+        sim->accel_boot_until_ns = 0;
+        sim->gyro_boot_until_ns = 0;
+    }
+}
+
+/*!
+ *  @brief This API points the device structure at the simulator.
+ */
+void bmi090l_sim_attach(struct bmi090l_sim *sim, struct bmi090l_dev *dev)
+{
+    if ((sim != NULL) && (dev != NULL))
+    {
+        dev->intf = sim->intf;
+        dev->intf_ptr_accel = &sim->accel_port;
+        dev->intf_ptr_gyro = &sim->gyro_port;
+        dev->read = bmi090l_sim_read;
+        dev->write = bmi090l_sim_write;
+        dev->delay_us = bmi090l_sim_delay_us;
+#ifdef BMI090L_BUS_STATS
+        dev->timestamp_us = bmi090l_sim_timestamp_us;
+#endif
+    }
+}
+
+/*!
+ *  @brief Read callback of the simulator.
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    BMI090L_INTF_RET_TYPE rslt;
+    struct bmi090l_sim_port *port = (struct bmi090l_sim_port *)intf_ptr;
+
+    if ((port == NULL) || (port->sim == NULL) || (reg_data == NULL))
+    {
+        rslt = SIM_INTF_FAIL;
+    }
+    else
+    {
+        advance(port->sim, port->sim->xfer_overhead_ns);
+        rslt = bus_read(port, reg_addr, reg_data, len);
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Write callback of the simulator.
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr)
+{
+    BMI090L_INTF_RET_TYPE rslt;
+    struct bmi090l_sim_port *port = (struct bmi090l_sim_port *)intf_ptr;
+
+    if ((port == NULL) || (port->sim == NULL) || (reg_data == NULL))
+    {
+        rslt = SIM_INTF_FAIL;
+    }
+    else
+    {
+        advance(port->sim, port->sim->xfer_overhead_ns);
+        rslt = bus_write(port, reg_addr, reg_data, len);
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Vectored transfer callback of the simulator.
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_xfer(const struct bmi090l_xfer_seg *seg, uint8_t count, void *intf_ptr)
+{
+    BMI090L_INTF_RET_TYPE rslt = BMI090L_INTF_RET_SUCCESS;
+    struct bmi090l_sim_port *port = (struct bmi090l_sim_port *)intf_ptr;
+    uint8_t indx;
+
+    if ((port == NULL) || (port->sim == NULL) || (seg == NULL))
+    {
+        rslt = SIM_INTF_FAIL;
+    }
+    else
+    {
+        /* One round trip for the whole batch */
+        advance(port->sim, port->sim->xfer_overhead_ns);
+        port->sim->xfer_count++;
+
+        for (indx = 0; (indx < count) && (rslt == BMI090L_INTF_RET_SUCCESS); indx++)
+        {
+            if (seg[indx].data == NULL)
+            {
+                rslt = SIM_INTF_FAIL;
+            }
+            else if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                rslt = bus_read(port, seg[indx].reg_addr, seg[indx].data, seg[indx].len);
+            }
+            else
+            {
+                rslt = bus_write(port, seg[indx].reg_addr, seg[indx].data, seg[indx].len);
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Non-blocking read callback of the simulator.
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_read_async(uint8_t reg_addr,
+                                             uint8_t *reg_data,
+                                             uint32_t len,
+                                             void *intf_ptr,
+                                             struct bmi090l_fifo_xfer *xfer)
+{
+    BMI090L_INTF_RET_TYPE rslt = BMI090L_INTF_RET_SUCCESS;
+    BMI090L_INTF_RET_TYPE xfer_rslt;
+    struct bmi090l_sim_port *port = (struct bmi090l_sim_port *)intf_ptr;
+
+    if ((port == NULL) || (port->sim == NULL) || (xfer == NULL))
+    {
+        rslt = SIM_INTF_FAIL;
+    }
+    else
+    {
+        /* The transfer completes at once, completion is reported before returning */
+        xfer_rslt = bmi090l_sim_read(reg_addr, reg_data, len, intf_ptr);
+
+        if (port->sensor == BMI090L_SIM_ACCEL)
+        {
+            (void)bmi090la_fifo_read_complete(xfer, xfer_rslt);
+        }
+        else
+        {
+            (void)bmi090lg_fifo_read_complete(xfer, xfer_rslt);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief Delay callback of the simulator.
+ */
+void bmi090l_sim_delay_us(uint32_t period, void *intf_ptr)
+{
+    struct bmi090l_sim_port *port = (struct bmi090l_sim_port *)intf_ptr;
+
+    if ((port != NULL) && (port->sim != NULL))
+    {
+        advance(port->sim, (uint64_t)period * 1000);
+    }
+}
+
+/*!
+ *  @brief This API lets time pass outside of driver calls.
+ */
+void bmi090l_sim_advance_us(struct bmi090l_sim *sim, uint32_t period)
+{
+    if (sim != NULL)
+    {
+        advance(sim, (uint64_t)period * 1000);
+    }
+}
+
+/*!
+ *  @brief This API returns the virtual time.
+ */
+uint64_t bmi090l_sim_get_time_ns(const struct bmi090l_sim *sim)
+{
+    uint64_t time_ns = 0;
+
+    if (sim != NULL)
+    {
+        time_ns = sim->time_ns;
+    }
+
+    return time_ns;
+}
+
+uint32_t bmi090l_sim_timestamp_us(void *intf_ptr)
+{
+    const struct bmi090l_sim_port *port = (const struct bmi090l_sim_port *)intf_ptr;
+    uint32_t time_us = 0;
+
+    if ((port != NULL) && (port->sim != NULL))
+    {
+        time_us = (uint32_t)(port->sim->time_ns / 1000);
+    }
+
+    return time_us;
+}
+
+/*****************************************************************************/
+/* Static function definition */
+
+/*! @cond DOXYGEN_SUPRESS */
+
+/*!
+ * @brief This internal API converts virtual time to sensor time ticks.
+ */
+static uint64_t ns_to_ticks(uint64_t time_ns)
+{
+    return (time_ns * SIM_NS_PER_TICK_DEN) / SIM_NS_PER_TICK_NUM;
+}
+
+/*!
+ * @brief This internal API converts sensor time ticks to virtual time.
+ */
+static uint64_t ticks_to_ns(uint64_t ticks)
+{
+    return ((ticks * SIM_NS_PER_TICK_NUM) + SIM_NS_PER_TICK_DEN - 1) / SIM_NS_PER_TICK_DEN;
+}
+
+/*!
+ * @brief This internal API advances the virtual clock.
+ */
+static void advance(struct bmi090l_sim *sim, uint64_t time_ns)
+{
+    sim->time_ns += time_ns;
+    update(sim);
+}
+
+/*!
+ * @brief This internal API brings the model up to date.
+ */
+static void update(struct bmi090l_sim *sim)
+{
+    uint64_t now_tick;
+    uint64_t period;
+
+    /* Config initialization */
+    if ((sim->asic_pending != 0) && (sim->time_ns >= sim->asic_done_ns))
+    {
+        sim->asic_pending = 0;
+        sim->accel_reg[BMI090L_REG_ACCEL_INTERNAL_STAT] = sim->asic_result;
+
+        if (sim->asic_result == BMI090L_ASIC_INITIALIZED)
+        {
+            (void)memset(sim->feature, 0, sizeof(sim->feature));
+            sim->feature[BMI090L_ADDR_CONFIG_ID_START] = BMI090L_GET_LSB(sim->config_id);
+            sim->feature[BMI090L_ADDR_CONFIG_ID_START + 1] = BMI090L_GET_MSB(sim->config_id);
+            sim->feature[BMI090L_ADDR_AXES_REMAP_START] = SIM_FEATURE_REMAP_RESET;
+            sim->sync_next_ns = sim->time_ns;
+        }
+    }
+
+    /* Accel sampling */
+    if ((sim->accel_reg[BMI090L_REG_ACCEL_PWR_CTRL] == BMI090L_ACCEL_POWER_ENABLE) &&
+        (sim->time_ns >= sim->accel_boot_until_ns))
+    {
+        now_tick = ns_to_ticks(sim->time_ns);
+        period = accel_period_ticks(sim);
+        while (sim->accel_next_tick <= now_tick)
+        {
+            accel_take_sample(sim, sim->accel_next_tick);
+            sim->accel_next_tick += period;
+        }
+
+        accel_update_sync(sim);
+    }
+
+    /* Gyro sampling */
+    if ((sim->gyro_reg[BMI090L_REG_GYRO_LPM1] == BMI090L_GYRO_PM_NORMAL) &&
+        (sim->time_ns >= sim->gyro_boot_until_ns))
+    {
+        period = gyro_period_ns(sim);
+        while (sim->gyro_next_ns <= sim->time_ns)
+        {
+            gyro_take_sample(sim, sim->gyro_next_ns);
+            sim->gyro_next_ns += period;
+        }
+    }
+
+    /* Gyro self-test */
+    if ((sim->gyro_reg[BMI090L_REG_GYRO_SELF_TEST] & SIM_GYRO_SELF_TEST_TRIG) &&
+        (sim->time_ns >= sim->gyro_self_test_ns))
+    {
+        sim->gyro_reg[BMI090L_REG_GYRO_SELF_TEST] = SIM_GYRO_SELF_TEST_DONE;
+    }
+}
+
+/*!
+ * @brief This internal API returns a sample of the given sensor.
+ */
+static void get_sample(const struct bmi090l_sim *sim,
+                       uint8_t sensor,
+                       uint64_t time_ns,
+                       struct bmi090l_sensor_data *data)
+{
+    if (sim->sample_cb != NULL)
+    {
+        sim->sample_cb(sensor, time_ns, data, sim->sample_ctx);
+    }
+    else if (sensor == BMI090L_SIM_ACCEL)
+    {
+        *data = sim->accel_value;
+    }
+    else
+    {
+        *data = sim->gyro_value;
+    }
+}
+
+/*!
+ * @brief This internal API stores a 16 bit value little endian.
+ */
+static void put_le16(uint8_t *buf, int16_t value)
+{
+    buf[0] = BMI090L_GET_LSB((uint16_t)value);
+    buf[1] = BMI090L_GET_MSB((uint16_t)value);
+}
+
+/*!
+ * @brief This internal API resets the accel to its power-on state.
+ */
+static void accel_reset(struct bmi090l_sim *sim)
+{
+    (void)memset(sim->accel_reg, 0, sizeof(sim->accel_reg));
+    (void)memset(sim->feature, 0, sizeof(sim->feature));
+    (void)memset(sim->config_written, 0, sizeof(sim->config_written));
+
+    sim->accel_reg[BMI090L_REG_ACCEL_CHIP_ID] = BMI090L_ACCEL_CHIP_ID;
+    sim->accel_reg[BMI090L_REG_TEMP_MSB] = SIM_TEMP_MSB_RESET;
+    sim->accel_reg[BMI090L_REG_TEMP_LSB] = SIM_TEMP_LSB_RESET;
+    sim->accel_reg[BMI090L_REG_ACCEL_CONF] = SIM_ACCEL_CONF_RESET;
+    sim->accel_reg[BMI090L_REG_ACCEL_RANGE] = SIM_ACCEL_RANGE_RESET;
+    sim->accel_reg[BMI090L_FIFO_DOWNS_ADDR] = SIM_FIFO_DOWNS_RESET;
+    sim->accel_reg[BMI090L_FIFO_WTM_1_ADDR] = SIM_FIFO_WTM_1_RESET;
+    sim->accel_reg[BMI090L_FIFO_CONFIG_0_ADDR] = SIM_FIFO_CONFIG_0_RESET;
+    sim->accel_reg[BMI090L_FIFO_CONFIG_1_ADDR] = SIM_FIFO_CONFIG_1_RESET;
+    sim->accel_reg[BMI090L_REG_ACCEL_INIT_CTRL] = BMI090L_ENABLE;
+    sim->accel_reg[BMI090L_REG_ACCEL_PWR_CONF] = SIM_PWR_CONF_RESET;
+
+    sim->accel_spi_active = 0;
+    sim->accel_boot_until_ns = sim->time_ns + ((uint64_t)sim->accel_boot_us * 1000);
+    sim->asic_pending = 0;
+    (void)memset(&sim->accel_sample, 0, sizeof(sim->accel_sample));
+    accel_fifo_flush(sim);
+}
+
+/*!
+ * @brief This internal API returns the accel sample period in ticks.
+ */
+static uint32_t accel_period_ticks(const struct bmi090l_sim *sim)
+{
+    uint8_t odr = sim->accel_reg[BMI090L_REG_ACCEL_CONF] & BMI090L_ACCEL_ODR_MASK;
+
+    if ((odr < BMI090L_ACCEL_ODR_12_5_HZ) || (odr > BMI090L_ACCEL_ODR_1600_HZ))
+    {
+        /* Reserved settings run at the reset rate */
+        odr = BMI090L_ACCEL_ODR_100_HZ;
+    }
+
+    /* 1600 Hz is 16 ticks, every lower setting halves the rate */
+    return UINT32_C(16) << (BMI090L_ACCEL_ODR_1600_HZ - odr);
+}
+
+/*!
+ * @brief This internal API aligns the accel sampling clock.
+ */
+static void accel_restart_clock(struct bmi090l_sim *sim, uint64_t start_ns)
+{
+    uint64_t period = accel_period_ticks(sim);
+    uint64_t tick = ns_to_ticks(start_ns) + 1;
+
+    /* Samples are taken on the sensor time grid of the output data rate */
+    sim->accel_next_tick = ((tick + period - 1) / period) * period;
+}
+
+/*!
+ * @brief This internal API takes an accel sample.
+ */
+static void accel_take_sample(struct bmi090l_sim *sim, uint64_t tick)
+{
+    struct bmi090l_sensor_data data;
+    uint8_t frame[BMI090L_FIFO_ACCEL_LENGTH + 1];
+    uint8_t range = sim->accel_reg[BMI090L_REG_ACCEL_RANGE] & BMI090L_ACCEL_RANGE_MASK;
+    uint8_t self_test = sim->accel_reg[BMI090L_REG_ACCEL_SELF_TEST];
+    uint8_t downs;
+    int32_t sign = 0;
+    int32_t value[3];
+    uint8_t indx;
+
+    get_sample(sim, BMI090L_SIM_ACCEL, ticks_to_ns(tick), &data);
+
+    if (self_test == BMI090L_ACCEL_POSITIVE_SELF_TEST)
+    {
+        sign = 1;
+    }
+    else if (self_test == BMI090L_ACCEL_NEGATIVE_SELF_TEST)
+    {
+        sign = -1;
+    }
+
+    /* Self-test excitation, scaled to the selected range (range 0 is 3 g) */
+    value[0] = data.x + ((sign * SIM_SELF_TEST_XY_MG * 32768) / (INT32_C(3000) << range));
+    value[1] = data.y + ((sign * SIM_SELF_TEST_XY_MG * 32768) / (INT32_C(3000) << range));
+    value[2] = data.z + ((sign * SIM_SELF_TEST_Z_MG * 32768) / (INT32_C(3000) << range));
+    for (indx = 0; indx < 3; indx++)
+    {
+        if (value[indx] > INT16_MAX)
+        {
+            value[indx] = INT16_MAX;
+        }
+        else if (value[indx] < INT16_MIN)
+        {
+            value[indx] = INT16_MIN;
+        }
+    }
+
+    sim->accel_sample.x = (int16_t)value[0];
+    sim->accel_sample.y = (int16_t)value[1];
+    sim->accel_sample.z = (int16_t)value[2];
+    sim->accel_sample_count++;
+
+    put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_X_LSB], sim->accel_sample.x);
+    put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_Y_LSB], sim->accel_sample.y);
+    put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_Z_LSB], sim->accel_sample.z);
+    sim->accel_reg[BMI090L_REG_ACCEL_STATUS] |= BMI090L_ACCEL_STATUS_MASK;
+    sim->accel_reg[BMI090L_REG_ACCEL_INT_STAT_1] |= BMI090L_ACCEL_DATA_READY_INT;
+
+    /* FIFO takes every 2^downs-th sample of the grid, bit 7 is reserved */
+    downs = BMI090L_GET_BITS(sim->accel_reg[BMI090L_FIFO_DOWNS_ADDR], BMI090L_ACC_FIFO_DOWNS) & SIM_FIFO_DOWNS_MASK;
+    if ((sim->accel_reg[BMI090L_FIFO_CONFIG_1_ADDR] & BMI090L_ACCEL_EN_MASK) &&
+        (((tick / accel_period_ticks(sim)) & ((UINT64_C(1) << downs) - 1)) == 0))
+    {
+        frame[0] = BMI090L_FIFO_HEADER_ACC_FRM;
+        put_le16(&frame[1], sim->accel_sample.x);
+        put_le16(&frame[3], sim->accel_sample.y);
+        put_le16(&frame[5], sim->accel_sample.z);
+        accel_fifo_push(sim, frame, sizeof(frame));
+    }
+}
+
+/*!
+ * @brief This internal API updates the data synchronization registers.
+ */
+static void accel_update_sync(struct bmi090l_sim *sim)
+{
+    struct bmi090l_sensor_data data;
+    uint8_t mode = sim->feature[SIM_FEATURE_SYNC_BYTE] & BMI090L_ACCEL_DATA_SYNC_MODE_MASK;
+    uint64_t period;
+
+    if ((sim->accel_reg[BMI090L_REG_ACCEL_INTERNAL_STAT] == BMI090L_ASIC_INITIALIZED) &&
+        (mode != BMI090L_ACCEL_DATA_SYNC_MODE_OFF))
+    {
+        if (mode == BMI090L_ACCEL_DATA_SYNC_MODE_400HZ)
+        {
+            period = UINT64_C(2500000);
+        }
+        else if (mode == BMI090L_ACCEL_DATA_SYNC_MODE_1000HZ)
+        {
+            period = UINT64_C(1000000);
+        }
+        else
+        {
+            period = UINT64_C(500000);
+        }
+
+        if (sim->sync_next_ns <= sim->time_ns)
+        {
+            /* Only the latest synchronized sample is visible */
+            sim->sync_next_ns = (sim->time_ns / period) * period;
+            get_sample(sim, BMI090L_SIM_ACCEL, sim->sync_next_ns, &data);
+            put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_GP_0], data.x);
+            put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_GP_0 + 2], data.y);
+            put_le16(&sim->accel_reg[BMI090L_REG_ACCEL_GP_4], data.z);
+            sim->accel_reg[BMI090L_REG_ACCEL_INT_STAT_0] |= BMI090L_ACCEL_DATA_SYNC_INT;
+            sim->sync_next_ns += period;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API returns the length of an accel FIFO frame.
+ */
+static uint8_t accel_frame_length(uint8_t header)
+{
+    uint8_t len;
+
+    switch (header)
+    {
+        case BMI090L_FIFO_HEADER_ACC_FRM:
+            len = BMI090L_FIFO_ACCEL_LENGTH + 1;
+            break;
+        case BMI090L_FIFO_HEADER_SENS_TIME_FRM:
+            len = BMI090L_SENSOR_TIME_LENGTH + 1;
+            break;
+        case BMI090L_FIFO_HEADER_SKIP_FRM:
+        case BMI090L_FIFO_HEADER_INPUT_CFG_FRM:
+        case BMI090L_FIFO_SAMPLE_DROP_FRM:
+            len = 2;
+            break;
+        default:
+            len = 1;
+            break;
+    }
+
+    return len;
+}
+
+/*!
+ * @brief This internal API appends a frame to the accel FIFO.
+ */
+static void accel_fifo_push(struct bmi090l_sim *sim, const uint8_t *frame, uint8_t len)
+{
+    uint8_t skip_frame[2];
+
+    if (sim->accel_reg[BMI090L_FIFO_CONFIG_0_ADDR] & BMI090L_ACC_FIFO_MODE_CONFIG_MASK)
+    {
+        /* FIFO mode: keep the old data, count what is lost */
+        if ((sim->accel_fifo_fill + len + ((sim->accel_fifo_skipped != 0) ? 2 : 0)) > BMI090L_SIM_ACCEL_FIFO_SIZE)
+        {
+            if (sim->accel_fifo_skipped < UINT8_MAX)
+            {
+                sim->accel_fifo_skipped++;
+            }
+        }
+        else
+        {
+            if (sim->accel_fifo_skipped != 0)
+            {
+                skip_frame[0] = BMI090L_FIFO_HEADER_SKIP_FRM;
+                skip_frame[1] = sim->accel_fifo_skipped;
+                accel_fifo_append(sim, skip_frame, sizeof(skip_frame));
+                sim->accel_fifo_skipped = 0;
+            }
+
+            accel_fifo_append(sim, frame, len);
+        }
+    }
+    else
+    {
+        /* Stream mode: the oldest frames make room */
+        while ((sim->accel_fifo_fill + len) > BMI090L_SIM_ACCEL_FIFO_SIZE)
+        {
+            accel_fifo_drop(sim);
+        }
+
+        accel_fifo_append(sim, frame, len);
+    }
+}
+
+/*!
+ * @brief This internal API appends bytes to the accel FIFO ring.
+ */
+static void accel_fifo_append(struct bmi090l_sim *sim, const uint8_t *frame, uint8_t len)
+{
+    uint8_t indx;
+    uint16_t pos;
+
+    for (indx = 0; indx < len; indx++)
+    {
+        pos = (uint16_t)((sim->accel_fifo_head + sim->accel_fifo_fill) % BMI090L_SIM_ACCEL_FIFO_SIZE);
+        sim->accel_fifo[pos] = frame[indx];
+        sim->accel_fifo_fill++;
+    }
+}
+
+/*!
+ * @brief This internal API drops the oldest accel FIFO frame.
+ */
+static void accel_fifo_drop(struct bmi090l_sim *sim)
+{
+    uint8_t len = accel_frame_length(sim->accel_fifo[sim->accel_fifo_head]);
+
+    if (len > sim->accel_fifo_fill)
+    {
+        len = (uint8_t)sim->accel_fifo_fill;
+    }
+
+    sim->accel_fifo_head = (uint16_t)((sim->accel_fifo_head + len) % BMI090L_SIM_ACCEL_FIFO_SIZE);
+    sim->accel_fifo_fill -= len;
+    sim->accel_fifo_frame_rd = 0;
+}
+
+/*!
+ * @brief This internal API clears the accel FIFO.
+ */
+static void accel_fifo_flush(struct bmi090l_sim *sim)
+{
+    sim->accel_fifo_head = 0;
+    sim->accel_fifo_fill = 0;
+    sim->accel_fifo_frame_rd = 0;
+    sim->accel_fifo_skipped = 0;
+}
+
+/*!
+ * @brief This internal API returns the next byte of the accel FIFO.
+ */
+static uint8_t accel_fifo_read(struct bmi090l_sim *sim)
+{
+    uint8_t data;
+    uint8_t len;
+
+    if ((sim->accel_fifo_fill > 0) && (sim->accel_fifo_tail_idx == 0))
+    {
+        len = accel_frame_length(sim->accel_fifo[sim->accel_fifo_head]);
+        data = sim->accel_fifo[(sim->accel_fifo_head + sim->accel_fifo_frame_rd) % BMI090L_SIM_ACCEL_FIFO_SIZE];
+        sim->accel_fifo_frame_rd++;
+
+        /* A frame leaves the FIFO once its last byte is read */
+        if (sim->accel_fifo_frame_rd >= len)
+        {
+            accel_fifo_drop(sim);
+        }
+    }
+    else
+    {
+        /* Reading past the end yields a sensor time frame, then over-read bytes */
+        switch (sim->accel_fifo_tail_idx)
+        {
+            case 0:
+                sim->accel_fifo_tail_time = (uint32_t)(ns_to_ticks(sim->time_ns) & SIM_SENSOR_TIME_MASK);
+                data = BMI090L_FIFO_HEADER_SENS_TIME_FRM;
+                sim->accel_fifo_tail_idx++;
+                break;
+            case 1:
+            case 2:
+            case 3:
+                data = (uint8_t)(sim->accel_fifo_tail_time >> (8 * (sim->accel_fifo_tail_idx - 1)));
+                sim->accel_fifo_tail_idx++;
+                break;
+            default:
+                data = BMI090L_FIFO_HEAD_OVER_READ_MSB;
+                break;
+        }
+    }
+
+    return data;
+}
+
+/*!
+ * @brief This internal API reads one accel register.
+ */
+static uint8_t accel_read_reg(struct bmi090l_sim *sim, uint8_t addr)
+{
+    uint8_t data;
+    uint32_t sensor_time;
+    uint16_t wm;
+
+    switch (addr)
+    {
+        case BMI090L_REG_ACCEL_SENSORTIME_0:
+        case BMI090L_REG_ACCEL_SENSORTIME_1:
+        case BMI090L_REG_ACCEL_SENSORTIME_2:
+            sensor_time = (uint32_t)(ns_to_ticks(sim->time_ns) & SIM_SENSOR_TIME_MASK);
+            data = (uint8_t)(sensor_time >> (8 * (addr - BMI090L_REG_ACCEL_SENSORTIME_0)));
+            break;
+        case BMI090L_REG_ACCEL_INT_STAT_1:
+            wm = (uint16_t)((sim->accel_reg[BMI090L_FIFO_WTM_1_ADDR] << 8) | sim->accel_reg[BMI090L_FIFO_WTM_0_ADDR]);
+            data = sim->accel_reg[addr] & BMI090L_ACCEL_DATA_READY_INT;
+            if ((wm != 0) && (sim->accel_fifo_fill >= wm))
+            {
+                data |= BMI090L_ACCEL_FIFO_WM_INT;
+            }
+
+            if ((sim->accel_fifo_fill + BMI090L_FIFO_ACCEL_LENGTH + 1) > BMI090L_SIM_ACCEL_FIFO_SIZE)
+            {
+                data |= BMI090L_ACCEL_FIFO_FULL_INT;
+            }
+
+            break;
+        case BMI090L_FIFO_LENGTH_0_ADDR:
+            data = BMI090L_GET_LSB(sim->accel_fifo_fill);
+            break;
+        case BMI090L_FIFO_LENGTH_1_ADDR:
+            data = BMI090L_GET_MSB(sim->accel_fifo_fill) & BMI090L_FIFO_BYTE_COUNTER_MSB_MASK;
+            break;
+        case BMI090L_FIFO_DATA_ADDR:
+            data = accel_fifo_read(sim);
+            break;
+        case BMI090L_REG_ACCEL_FEATURE_CFG:
+            data = sim->feature[sim->feature_idx % BMI090L_SIM_FEATURE_SIZE];
+            sim->feature_idx++;
+            break;
+        default:
+            data = sim->accel_reg[addr];
+            break;
+    }
+
+    return data;
+}
+
+/*!
+ * @brief This internal API writes one accel register.
+ */
+static void accel_write_reg(struct bmi090l_sim *sim, uint8_t addr, uint8_t data)
+{
+    uint8_t was_enabled;
+
+    switch (addr)
+    {
+        case BMI090L_REG_ACCEL_SOFTRESET:
+            if (data == BMI090L_SOFT_RESET_CMD)
+            {
+                accel_reset(sim);
+            }
+            else if (data == SIM_ACCEL_FIFO_FLUSH)
+            {
+                accel_fifo_flush(sim);
+            }
+
+            break;
+        case BMI090L_REG_ACCEL_PWR_CTRL:
+            was_enabled = (sim->accel_reg[addr] == BMI090L_ACCEL_POWER_ENABLE);
+            sim->accel_reg[addr] = data;
+            if ((data == BMI090L_ACCEL_POWER_ENABLE) && !was_enabled)
+            {
+                accel_restart_clock(sim, sim->time_ns + ((uint64_t)sim->accel_startup_us * 1000));
+            }
+
+            break;
+        case BMI090L_REG_ACCEL_CONF:
+            sim->accel_reg[addr] = data;
+            accel_restart_clock(sim, sim->time_ns);
+            break;
+        case BMI090L_REG_ACCEL_INIT_CTRL:
+            sim->accel_reg[addr] = data;
+            if (data == BMI090L_DISABLE)
+            {
+                /* Prepare for a new config upload */
+                sim->accel_reg[BMI090L_REG_ACCEL_INTERNAL_STAT] = SIM_INTERNAL_NOT_INIT;
+                sim->asic_pending = 0;
+                (void)memset(sim->config_written, 0, sizeof(sim->config_written));
+            }
+            else if (data == BMI090L_ENABLE)
+            {
+                accel_start_init(sim);
+            }
+
+            break;
+        case BMI090L_REG_ACCEL_FEATURE_CFG:
+            accel_write_feature(sim, data);
+            break;
+        case BMI090L_REG_ACCEL_RANGE:
+        case BMI090L_FIFO_DOWNS_ADDR:
+        case BMI090L_FIFO_WTM_0_ADDR:
+        case BMI090L_FIFO_WTM_1_ADDR:
+        case BMI090L_FIFO_CONFIG_0_ADDR:
+        case BMI090L_FIFO_CONFIG_1_ADDR:
+        case BMI090L_REG_ACCEL_INT1_IO_CONF:
+        case BMI090L_REG_ACCEL_INT2_IO_CONF:
+        case BMI090L_REG_ACCEL_INT_LATCH_CONF:
+        case BMI090L_REG_ACCEL_INT1_MAP:
+        case BMI090L_REG_ACCEL_INT2_MAP:
+        case BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA:
+        case BMI090L_REG_ACCEL_RESERVED_5B:
+        case BMI090L_REG_ACCEL_RESERVED_5C:
+        case BMI090L_REG_ACCEL_SELF_TEST:
+        case BMI090L_REG_ACCEL_PWR_CONF:
+            sim->accel_reg[addr] = data;
+            break;
+        default:
+
+            /* Read-only or reserved register */
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API handles a write to the feature configuration window.
+ */
+static void accel_write_feature(struct bmi090l_sim *sim, uint8_t data)
+{
+    uint32_t offset;
+
+    if (sim->accel_reg[BMI090L_REG_ACCEL_INIT_CTRL] == BMI090L_DISABLE)
+    {
+        /* Config upload, addressed in words through the two reserved registers */
+        offset = (uint32_t)(((sim->accel_reg[BMI090L_REG_ACCEL_RESERVED_5C] << 4) |
+                             (sim->accel_reg[BMI090L_REG_ACCEL_RESERVED_5B] & BMI090L_SET_LOW_NIBBLE)) * 2) +
+                 sim->feature_idx;
+
+        /* Burst writes are lost while advanced power save is active */
+        if ((offset < BMI090L_CONFIG_STREAM_SIZE) &&
+            ((sim->accel_reg[BMI090L_REG_ACCEL_PWR_CONF] & SIM_ACCEL_APS_MASK) == 0))
+        {
+            sim->config_prog[offset] = data;
+            sim->config_written[offset / 8] |= (uint8_t)(1 << (offset % 8));
+        }
+    }
+    else if (sim->accel_reg[BMI090L_REG_ACCEL_INTERNAL_STAT] == BMI090L_ASIC_INITIALIZED)
+    {
+        /* The config ID is owned by the device */
+        if ((sim->feature_idx < BMI090L_SIM_FEATURE_SIZE) && (sim->feature_idx != BMI090L_ADDR_CONFIG_ID_START) &&
+            (sim->feature_idx != (BMI090L_ADDR_CONFIG_ID_START + 1)))
+        {
+            sim->feature[sim->feature_idx] = data;
+        }
+    }
+
+    sim->feature_idx++;
+}
+
+/*!
+ * @brief This internal API starts the initialization of the uploaded config.
+ */
+static void accel_start_init(struct bmi090l_sim *sim)
+{
+    uint16_t indx;
+    uint8_t complete = TRUE;
+
+    for (indx = 0; indx < sizeof(sim->config_written); indx++)
+    {
+        if (sim->config_written[indx] != UINT8_MAX)
+        {
+            complete = FALSE;
+        }
+    }
+
+    if (complete && ((sim->config_ref == NULL) ||
+                     (memcmp(sim->config_prog, sim->config_ref, BMI090L_CONFIG_STREAM_SIZE) == 0)))
+    {
+        sim->asic_result = BMI090L_ASIC_INITIALIZED;
+    }
+    else
+    {
+        sim->asic_result = SIM_INTERNAL_INIT_ERR;
+    }
+
+    sim->asic_pending = 1;
+    sim->asic_done_ns = sim->time_ns + ((uint64_t)sim->asic_init_us * 1000);
+}
+
+/*!
+ * @brief This internal API resets the gyro to its power-on state.
+ */
+static void gyro_reset(struct bmi090l_sim *sim)
+{
+    (void)memset(sim->gyro_reg, 0, sizeof(sim->gyro_reg));
+
+    sim->gyro_reg[BMI090L_REG_GYRO_CHIP_ID] = BMI090L_GYRO_CHIP_ID;
+    sim->gyro_reg[BMI090L_REG_GYRO_BANDWIDTH] = BMI090L_GYRO_ODR_RESET_VAL;
+    sim->gyro_reg[BMI090L_REG_GYRO_INT3_INT4_IO_CONF] = SIM_GYRO_IO_CONF_RESET;
+    sim->gyro_reg[BMI090L_REG_GYRO_SELF_TEST] = SIM_GYRO_SELF_TEST_DONE;
+
+    sim->gyro_boot_until_ns = sim->time_ns + ((uint64_t)sim->gyro_boot_us * 1000);
+    sim->gyro_next_ns = sim->gyro_boot_until_ns;
+    sim->gyro_fifo_head = 0;
+    sim->gyro_fifo_count = 0;
+    sim->gyro_fifo_frame_rd = 0;
+    sim->gyro_fifo_overrun = 0;
+}
+
+/*!
+ * @brief This internal API returns the gyro sample period.
+ */
+static uint64_t gyro_period_ns(const struct bmi090l_sim *sim)
+{
+    uint64_t period;
+
+    switch (sim->gyro_reg[BMI090L_REG_GYRO_BANDWIDTH] & BMI090L_GYRO_BW_MASK)
+    {
+        case BMI090L_GYRO_BW_532_ODR_2000_HZ:
+        case BMI090L_GYRO_BW_230_ODR_2000_HZ:
+            period = UINT64_C(500000);
+            break;
+        case BMI090L_GYRO_BW_116_ODR_1000_HZ:
+            period = UINT64_C(1000000);
+            break;
+        case BMI090L_GYRO_BW_47_ODR_400_HZ:
+            period = UINT64_C(2500000);
+            break;
+        case BMI090L_GYRO_BW_23_ODR_200_HZ:
+        case BMI090L_GYRO_BW_64_ODR_200_HZ:
+            period = UINT64_C(5000000);
+            break;
+        default:
+            period = UINT64_C(10000000);
+            break;
+    }
+
+    return period;
+}
+
+/*!
+ * @brief This internal API takes a gyro sample.
+ */
+static void gyro_take_sample(struct bmi090l_sim *sim, uint64_t time_ns)
+{
+    struct bmi090l_sensor_data data;
+    uint8_t mode = BMI090L_GET_BITS(sim->gyro_reg[BMI090L_REG_GYRO_FIFO_CONFIG1], BMI090L_GYRO_FIFO_MODE);
+
+    get_sample(sim, BMI090L_SIM_GYRO, time_ns, &data);
+
+    put_le16(&sim->gyro_reg[BMI090L_REG_GYRO_X_LSB], data.x);
+    put_le16(&sim->gyro_reg[BMI090L_REG_GYRO_Y_LSB], data.y);
+    put_le16(&sim->gyro_reg[BMI090L_REG_GYRO_Z_LSB], data.z);
+    sim->gyro_reg[BMI090L_REG_GYRO_INT_STAT_1] |= BMI090L_GYRO_DATA_READY_INT;
+
+    if (mode != BMI090L_GYRO_FIFO_MODE_BYPASS)
+    {
+        if (sim->gyro_fifo_count >= BMI090L_SIM_GYRO_FIFO_FRAMES)
+        {
+            sim->gyro_fifo_overrun = 1;
+
+            if (mode == BMI090L_GYRO_FIFO_MODE_STREAM)
+            {
+                /* Stream mode overwrites the oldest frame */
+                sim->gyro_fifo_head = (uint8_t)((sim->gyro_fifo_head + 1) % BMI090L_SIM_GYRO_FIFO_FRAMES);
+                sim->gyro_fifo_count--;
+                sim->gyro_fifo_frame_rd = 0;
+            }
+        }
+
+        if (sim->gyro_fifo_count < BMI090L_SIM_GYRO_FIFO_FRAMES)
+        {
+            sim->gyro_fifo[(sim->gyro_fifo_head + sim->gyro_fifo_count) % BMI090L_SIM_GYRO_FIFO_FRAMES] = data;
+            sim->gyro_fifo_count++;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API returns the size of a gyro FIFO frame.
+ */
+static uint8_t gyro_frame_size(const struct bmi090l_sim *sim)
+{
+    uint8_t size = BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE;
+
+    if (BMI090L_GET_BITS_POS_0(sim->gyro_reg[BMI090L_REG_GYRO_FIFO_CONFIG1], BMI090L_GYRO_FIFO_DATA_SELECT) !=
+        BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
+    {
+        size = BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE;
+    }
+
+    if (sim->gyro_reg[BMI090L_REG_GYRO_FIFO_CONFIG0] & BMI090L_GYRO_FIFO_TAG_MASK)
+    {
+        size += 2;
+    }
+
+    return size;
+}
+
+/*!
+ * @brief This internal API returns the next byte of the gyro FIFO.
+ */
+static uint8_t gyro_fifo_read(struct bmi090l_sim *sim)
+{
+    const struct bmi090l_sensor_data *frame;
+    uint8_t select = BMI090L_GET_BITS_POS_0(sim->gyro_reg[BMI090L_REG_GYRO_FIFO_CONFIG1],
+                                            BMI090L_GYRO_FIFO_DATA_SELECT);
+    uint8_t bytes[BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE + 2];
+    uint8_t data_len;
+    uint8_t data = 0;
+
+    if (sim->gyro_fifo_count > 0)
+    {
+        frame = &sim->gyro_fifo[sim->gyro_fifo_head];
+        if (select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
+        {
+            put_le16(&bytes[0], frame->x);
+            put_le16(&bytes[2], frame->y);
+            put_le16(&bytes[4], frame->z);
+            data_len = BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE;
+        }
+        else
+        {
+            put_le16(&bytes[0],
+                     (select == BMI090L_GYRO_FIFO_X_AXIS_ENABLED) ? frame->x :
+                     (select == BMI090L_GYRO_FIFO_Y_AXIS_ENABLED) ? frame->y : frame->z);
+            data_len = BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE;
+        }
+
+        /* Interrupt tag follows the axis data */
+        put_le16(&bytes[data_len], (int16_t)sim->gyro_tag);
+
+        data = bytes[sim->gyro_fifo_frame_rd];
+        sim->gyro_fifo_frame_rd++;
+        if (sim->gyro_fifo_frame_rd >= gyro_frame_size(sim))
+        {
+            sim->gyro_fifo_head = (uint8_t)((sim->gyro_fifo_head + 1) % BMI090L_SIM_GYRO_FIFO_FRAMES);
+            sim->gyro_fifo_count--;
+            sim->gyro_fifo_frame_rd = 0;
+        }
+    }
+
+    return data;
+}
+
+/*!
+ * @brief This internal API reads one gyro register.
+ */
+static uint8_t gyro_read_reg(struct bmi090l_sim *sim, uint8_t addr)
+{
+    uint8_t data;
+    uint8_t wm_level;
+
+    switch (addr)
+    {
+        case BMI090L_REG_GYRO_INT_STAT_1:
+            data = sim->gyro_reg[addr] & BMI090L_GYRO_DATA_READY_INT;
+            wm_level = sim->gyro_reg[BMI090L_REG_GYRO_FIFO_CONFIG0] & BMI090L_GYRO_FIFO_WM_LEVEL_MASK;
+            if (((sim->gyro_reg[BMI090L_REG_GYRO_FIFO_WM_ENABLE] & BMI090L_GYRO_FIFO_WM_ENABLE_VAL) &&
+                 (sim->gyro_fifo_count >= wm_level)) || (sim->gyro_fifo_count >= BMI090L_SIM_GYRO_FIFO_FRAMES))
+            {
+                data |= BMI090L_GYRO_FIFO_WM_INT;
+            }
+
+            break;
+        case BMI090L_REG_GYRO_FIFO_STATUS:
+            data = (uint8_t)((sim->gyro_fifo_overrun << BMI090L_GYRO_FIFO_OVERRUN_POS) |
+                             (sim->gyro_fifo_count & BMI090L_GYRO_FIFO_FRAME_COUNT_MASK));
+            break;
+        case BMI090L_REG_GYRO_FIFO_DATA:
+            data = gyro_fifo_read(sim);
+            break;
+        default:
+            data = sim->gyro_reg[addr % BMI090L_SIM_GYRO_REG_SIZE];
+            break;
+    }
+
+    return data;
+}
+
+/*!
+ * @brief This internal API writes one gyro register.
+ */
+static void gyro_write_reg(struct bmi090l_sim *sim, uint8_t addr, uint8_t data)
+{
+    switch (addr)
+    {
+        case BMI090L_REG_GYRO_SOFTRESET:
+            if (data == BMI090L_SOFT_RESET_CMD)
+            {
+                gyro_reset(sim);
+            }
+
+            break;
+        case BMI090L_REG_GYRO_BANDWIDTH:
+
+            /* Bit 7 always reads back as set */
+            sim->gyro_reg[addr] = (uint8_t)(data | BMI090L_GYRO_ODR_RESET_VAL);
+            break;
+        case BMI090L_REG_GYRO_LPM1:
+            if ((data == BMI090L_GYRO_PM_NORMAL) && (sim->gyro_reg[addr] != BMI090L_GYRO_PM_NORMAL))
+            {
+                sim->gyro_next_ns = sim->time_ns + ((uint64_t)sim->gyro_startup_us * 1000);
+            }
+
+            sim->gyro_reg[addr] = data;
+            break;
+        case BMI090L_REG_GYRO_SELF_TEST:
+            if (data & SIM_GYRO_SELF_TEST_TRIG)
+            {
+                sim->gyro_reg[addr] = SIM_GYRO_SELF_TEST_TRIG;
+                sim->gyro_self_test_ns = sim->time_ns + ((uint64_t)BMI090L_SIM_GYRO_SELF_TEST_US * 1000);
+            }
+
+            break;
+        case BMI090L_REG_GYRO_FIFO_CONFIG1:
+
+            /* Writing the FIFO mode clears the FIFO */
+            sim->gyro_reg[addr] = data;
+            sim->gyro_fifo_head = 0;
+            sim->gyro_fifo_count = 0;
+            sim->gyro_fifo_frame_rd = 0;
+            sim->gyro_fifo_overrun = 0;
+            break;
+        case BMI090L_REG_GYRO_RANGE:
+        case BMI090L_REG_GYRO_INT_CTRL:
+        case BMI090L_REG_GYRO_INT3_INT4_IO_CONF:
+        case BMI090L_REG_GYRO_INT3_INT4_IO_MAP:
+        case BMI090L_REG_GYRO_FIFO_WM_ENABLE:
+        case BMI090L_REG_GYRO_FIFO_CONFIG0:
+            sim->gyro_reg[addr] = data;
+            break;
+        default:
+
+            /* Read-only or reserved register */
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API performs a burst read on the accel.
+ */
+static void accel_read(struct bmi090l_sim *sim, uint8_t reg_addr, uint8_t *reg_data, uint32_t len)
+{
+    uint32_t indx = 0;
+    uint8_t addr = reg_addr;
+    uint8_t data_read = FALSE;
+    uint8_t int_stat_read = FALSE;
+    uint8_t sync_read = FALSE;
+
+    if ((sim->intf == BMI090L_SPI_INTF) && (sim->accel_spi_active == 0))
+    {
+        /* The first access after power-up or reset only switches the accel to SPI */
+        sim->accel_spi_active = 1;
+        (void)memset(reg_data, 0xFF, len);
+    }
+    else if (sim->time_ns < sim->accel_boot_until_ns)
+    {
+        /* Still booting */
+        (void)memset(reg_data, 0, len);
+    }
+    else
+    {
+        if ((sim->intf == BMI090L_SPI_INTF) && (len > 0) && (sim->discard_dummy_byte == 0))
+        {
+            reg_data[0] = BMI090L_SIM_DUMMY_BYTE;
+            indx = 1;
+        }
+
+        /* A partially read FIFO frame is sent again in full */
+        sim->feature_idx = 0;
+        sim->accel_fifo_tail_idx = 0;
+        sim->accel_fifo_frame_rd = 0;
+        for (; indx < len; indx++)
+        {
+            reg_data[indx] = accel_read_reg(sim, addr);
+
+            if ((addr >= BMI090L_REG_ACCEL_X_LSB) && (addr <= BMI090L_REG_ACCEL_Z_MSB))
+            {
+                data_read = TRUE;
+            }
+            else if (addr == BMI090L_REG_ACCEL_INT_STAT_1)
+            {
+                int_stat_read = TRUE;
+            }
+            else if (addr == BMI090L_REG_ACCEL_INT_STAT_0)
+            {
+                sync_read = TRUE;
+            }
+
+            /* The address pointer stays on the FIFO data and feature windows */
+            if ((addr != BMI090L_FIFO_DATA_ADDR) && (addr != BMI090L_REG_ACCEL_FEATURE_CFG))
+            {
+                addr = (uint8_t)((addr + 1) & BMI090L_SPI_WR_MASK);
+            }
+        }
+
+        /* Status flags cleared by the read */
+        if (data_read)
+        {
+            sim->accel_reg[BMI090L_REG_ACCEL_STATUS] &= (uint8_t)~BMI090L_ACCEL_STATUS_MASK;
+        }
+
+        if (int_stat_read)
+        {
+            sim->accel_reg[BMI090L_REG_ACCEL_INT_STAT_1] &= (uint8_t)~BMI090L_ACCEL_DATA_READY_INT;
+        }
+
+        if (sync_read)
+        {
+            sim->accel_reg[BMI090L_REG_ACCEL_INT_STAT_0] = 0;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API performs a burst read on the gyro.
+ */
+static void gyro_read(struct bmi090l_sim *sim, uint8_t reg_addr, uint8_t *reg_data, uint32_t len)
+{
+    uint32_t indx;
+    uint8_t addr = reg_addr;
+    uint8_t data_read = FALSE;
+
+    if (sim->time_ns < sim->gyro_boot_until_ns)
+    {
+        /* Still booting */
+        (void)memset(reg_data, 0, len);
+    }
+    else
+    {
+        for (indx = 0; indx < len; indx++)
+        {
+            reg_data[indx] = gyro_read_reg(sim, addr);
+
+            if ((addr >= BMI090L_REG_GYRO_X_LSB) && (addr <= BMI090L_REG_GYRO_Z_MSB))
+            {
+                data_read = TRUE;
+            }
+
+            /* The address pointer stays on the FIFO data register */
+            if (addr != BMI090L_REG_GYRO_FIFO_DATA)
+            {
+                addr = (uint8_t)((addr + 1) & BMI090L_SPI_WR_MASK);
+            }
+        }
+
+        if (data_read)
+        {
+            sim->gyro_reg[BMI090L_REG_GYRO_INT_STAT_1] &= (uint8_t)~BMI090L_GYRO_DATA_READY_INT;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API performs one read transaction on the bus.
+ */
+static BMI090L_INTF_RET_TYPE bus_read(const struct bmi090l_sim_port *port,
+                                      uint8_t reg_addr,
+                                      uint8_t *reg_data,
+                                      uint32_t len)
+{
+    BMI090L_INTF_RET_TYPE rslt = BMI090L_INTF_RET_SUCCESS;
+    struct bmi090l_sim *sim = port->sim;
+
+    advance(sim, (uint64_t)len * sim->xfer_byte_ns);
+    sim->read_count++;
+    sim->read_bytes += len;
+
+    if (sim->intf == BMI090L_SPI_INTF)
+    {
+        if ((reg_addr & BMI090L_SPI_RD_MASK) == 0)
+        {
+            /* A read without the read bit is a write on the wire */
+            sim->protocol_errors++;
+            rslt = SIM_INTF_FAIL;
+        }
+
+        reg_addr &= BMI090L_SPI_WR_MASK;
+    }
+
+    if (rslt == BMI090L_INTF_RET_SUCCESS)
+    {
+        if (port->sensor == BMI090L_SIM_ACCEL)
+        {
+            accel_read(sim, reg_addr, reg_data, len);
+        }
+        else
+        {
+            gyro_read(sim, reg_addr, reg_data, len);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API performs one write transaction on the bus.
+ */
+static BMI090L_INTF_RET_TYPE bus_write(const struct bmi090l_sim_port *port,
+                                       uint8_t reg_addr,
+                                       const uint8_t *reg_data,
+                                       uint32_t len)
+{
+    BMI090L_INTF_RET_TYPE rslt = BMI090L_INTF_RET_SUCCESS;
+    struct bmi090l_sim *sim = port->sim;
+    uint32_t indx;
+    uint8_t addr = reg_addr;
+
+    advance(sim, (uint64_t)len * sim->xfer_byte_ns);
+    sim->write_count++;
+    sim->write_bytes += len;
+
+    if ((sim->intf == BMI090L_SPI_INTF) && ((reg_addr & BMI090L_SPI_RD_MASK) != 0))
+    {
+        /* A write with the read bit set is a read on the wire */
+        sim->protocol_errors++;
+        rslt = SIM_INTF_FAIL;
+    }
+    else if (port->sensor == BMI090L_SIM_ACCEL)
+    {
+        if ((sim->intf == BMI090L_SPI_INTF) && (sim->accel_spi_active == 0))
+        {
+            /* The first access after power-up or reset only switches the accel to SPI */
+            sim->accel_spi_active = 1;
+        }
+        else if (sim->time_ns >= sim->accel_boot_until_ns)
+        {
+            sim->feature_idx = 0;
+            for (indx = 0; indx < len; indx++)
+            {
+                accel_write_reg(sim, addr, reg_data[indx]);
+
+                /* The feature window keeps its address, the index moves inside the window */
+                if (addr != BMI090L_REG_ACCEL_FEATURE_CFG)
+                {
+                    addr = (uint8_t)((addr + 1) & BMI090L_SPI_WR_MASK);
+                }
+            }
+        }
+    }
+    else
+    {
+        if (len > 1)
+        {
+            /* The gyro does not support burst writes, only the first byte is taken */
+            sim->protocol_errors++;
+        }
+
+        if ((len > 0) && (sim->time_ns >= sim->gyro_boot_until_ns))
+        {
+            gyro_write_reg(sim, (uint8_t)(reg_addr & BMI090L_SPI_WR_MASK), reg_data[0]);
+        }
+    }
+
+    return rslt;
+}
+
+/*! @endcond */
@@ -0,0 +1,496 @@
+/**
+* Copyright (c) 2021 Bosch Sensortec GmbH. All rights reserved.
+*
+* BSD-3-Clause
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright
+*    notice, this list of conditions and the following disclaimer.
+*
+* 2. Redistributions in binary form must reproduce the above copyright
+*    notice, this list of conditions and the following disclaimer in the
+*    documentation and/or other materials provided with the distribution.
+*
+* 3. Neither the name of the copyright holder nor the names of its
+*    contributors may be used to endorse or promote products derived from
+*    this software without specific prior written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+* "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+* LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS
+* FOR A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE
+* COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+* (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+* SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+* HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+* STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+* IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+* POSSIBILITY OF SUCH DAMAGE.
+*
+* @file       bmi090l_sim.h
+* @date       2021-04-15
+* @version    v1.1.6
+*
+*/
+
+/*! \file bmi090l_sim.h
+ * \brief Register level software model of the BMI090L, usable as bus backend */
+
+/*!
+ * @defgroup bmi090lSim BMI090L simulator
+ * @brief Simulated accel and gyro behind the bmi090l_dev read/write/delay callbacks
+ *
+ * The model covers the accel and gyro register maps, the SPI dummy byte of the
+ * accel, the header mode accel FIFO, the gyro FIFO including the interrupt tag,
+ * the sensor time, the feature configuration window and the config stream
+ * upload. Time only advances through bus traffic and the delay callback, so
+ * test suites run far faster than real time and are fully deterministic.
+ */
+
+#ifndef BMI090L_SIM_H_
+#define BMI090L_SIM_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************************************************************/
+/* Header files */
+#include "bmi090l_defs.h"
+
+/*********************************************************************/
+/* Macros */
+
+/**\name    Simulated sensor selection */
+#define BMI090L_SIM_ACCEL                            UINT8_C(0)
+#define BMI090L_SIM_GYRO                             UINT8_C(1)
+
+/**\name    Sizes of the simulated memories */
+#define BMI090L_SIM_ACCEL_REG_SIZE                   UINT16_C(128)
+#define BMI090L_SIM_GYRO_REG_SIZE                    UINT16_C(64)
+#define BMI090L_SIM_ACCEL_FIFO_SIZE                  UINT16_C(1024)
+#define BMI090L_SIM_GYRO_FIFO_FRAMES                 UINT8_C(100)
+#define BMI090L_SIM_FEATURE_SIZE                     UINT8_C(64)
+
+/**\name    Value returned in the SPI dummy byte position */
+#define BMI090L_SIM_DUMMY_BYTE                       UINT8_C(0xA5)
+
+/**\name    Default timing of the model, in microseconds */
+#define BMI090L_SIM_ACCEL_BOOT_US                    UINT32_C(300)
+#define BMI090L_SIM_ACCEL_STARTUP_US                 UINT32_C(1000)
+#define BMI090L_SIM_GYRO_BOOT_US                     UINT32_C(10000)
+#define BMI090L_SIM_GYRO_STARTUP_US                  UINT32_C(10000)
+#define BMI090L_SIM_GYRO_SELF_TEST_US                UINT32_C(10000)
+#define BMI090L_SIM_ASIC_INIT_US                     UINT32_C(20000)
+
+/*********************************************************************/
+/* Data structures */
+
+struct bmi090l_sim;
+
+/*!
+ * @brief Sample source of the simulator
+ *
+ * @param[in]  sensor  : BMI090L_SIM_ACCEL or BMI090L_SIM_GYRO.
+ * @param[in]  time_ns : Virtual time of the sample in nanoseconds.
+ * @param[out] data    : Raw sensor data in LSB, before self-test excitation.
+ * @param[in]  ctx     : User context given in bmi090l_sim.sample_ctx.
+ */
+typedef void (*bmi090l_sim_sample_fptr_t)(uint8_t sensor, uint64_t time_ns, struct bmi090l_sensor_data *data,
+                                          void *ctx);
+
+/*!
+ * @brief Bus port of the simulator, handed out as intf_ptr_accel / intf_ptr_gyro
+ */
+struct bmi090l_sim_port
+{
+    /*! Simulator owning the port */
+    struct bmi090l_sim *sim;
+
+    /*! Sensor addressed through the port */
+    uint8_t sensor;
+};
+
+/*!
+ * @brief State of the simulated BMI090L
+ *
+ * The structure is owned by the caller, no memory is allocated. Fields below
+ * "Configuration" may be changed after bmi090l_sim_init(), the remaining
+ * fields are internal state of the model.
+ */
+struct bmi090l_sim
+{
+    /*! Accel bus port */
+    struct bmi090l_sim_port accel_port;
+
+    /*! Gyro bus port */
+    struct bmi090l_sim_port gyro_port;
+
+    /*! Simulated interface */
+    enum bmi090l_intf intf;
+
+    /* Configuration */
+
+    /*! Virtual time charged for every bus transaction */
+    uint32_t xfer_overhead_ns;
+
+    /*! Virtual time charged for every byte on the bus */
+    uint32_t xfer_byte_ns;
+
+    /*! Accel soft-reset boot time */
+    uint32_t accel_boot_us;
+
+    /*! Time from accel enable to the first sample */
+    uint32_t accel_startup_us;
+
+    /*! Gyro soft-reset boot time */
+    uint32_t gyro_boot_us;
+
+    /*! Time from gyro normal mode request to the first sample */
+    uint32_t gyro_startup_us;
+
+    /*! Time from INIT_CTRL = 1 until INTERNAL_STAT reports the result */
+    uint32_t asic_init_us;
+
+    /*! Reference config file compared against the upload, NULL to only check completeness */
+    const uint8_t *config_ref;
+
+    /*! Config ID word reported in the feature configuration once initialized, 0 by
+     * default. The simulator does not know the ID of the real config file */
+    uint16_t config_id;
+
+    /*! Constant accel sample used when no sample source is set */
+    struct bmi090l_sensor_data accel_value;
+
+    /*! Constant gyro sample used when no sample source is set */
+    struct bmi090l_sensor_data gyro_value;
+
+    /*! Optional sample source */
+    bmi090l_sim_sample_fptr_t sample_cb;
+
+    /*! Context passed to the sample source */
+    void *sample_ctx;
+
+    /*! Value stored in the two tag bytes of tagged gyro FIFO frames */
+    uint16_t gyro_tag;
+
+    /*! Emulate an SPI controller that drops the accel dummy byte (BMI090L_DUMMY_BYTE_INTF) */
+    uint8_t discard_dummy_byte;
+
+    /* Statistics */
+
+    /*! Number of read transactions, vectored segments count individually */
+    uint32_t read_count;
+
+    /*! Number of write transactions, vectored segments count individually */
+    uint32_t write_count;
+
+    /*! Number of vectored transfers */
+    uint32_t xfer_count;
+
+    /*! Number of bytes read, including dummy bytes */
+    uint32_t read_bytes;
+
+    /*! Number of bytes written */
+    uint32_t write_bytes;
+
+    /*! Accesses the real device would not accept (wrong SPI address bit, gyro burst write) */
+    uint32_t protocol_errors;
+
+    /* Internal state */
+
+    /*! Virtual time in nanoseconds */
+    uint64_t time_ns;
+
+    /*! Accel register map */
+    uint8_t accel_reg[BMI090L_SIM_ACCEL_REG_SIZE];
+
+    /*! Accel has seen the SPI mode switching access */
+    uint8_t accel_spi_active;
+
+    /*! Accel registers are inaccessible until this time */
+    uint64_t accel_boot_until_ns;
+
+    /*! Sensor time tick of the next accel sample */
+    uint64_t accel_next_tick;
+
+    /*! Accel samples taken since the sampling clock was started */
+    uint32_t accel_sample_count;
+
+    /*! Current accel sample */
+    struct bmi090l_sensor_data accel_sample;
+
+    /*! Accel FIFO ring buffer */
+    uint8_t accel_fifo[BMI090L_SIM_ACCEL_FIFO_SIZE];
+
+    /*! Index of the oldest accel FIFO byte */
+    uint16_t accel_fifo_head;
+
+    /*! Number of bytes in the accel FIFO */
+    uint16_t accel_fifo_fill;
+
+    /*! Bytes already read from the oldest accel FIFO frame */
+    uint8_t accel_fifo_frame_rd;
+
+    /*! Frames dropped since the last skip frame (FIFO mode) */
+    uint8_t accel_fifo_skipped;
+
+    /*! Progress through the sensor time / over-read bytes of the current burst */
+    uint8_t accel_fifo_tail_idx;
+
+    /*! Captured sensor time of the current burst */
+    uint32_t accel_fifo_tail_time;
+
+    /*! Byte offset into the feature window for the current burst */
+    uint8_t feature_idx;
+
+    /*! Feature configuration memory */
+    uint8_t feature[BMI090L_SIM_FEATURE_SIZE];
+
+    /*! Uploaded config program */
+    uint8_t config_prog[BMI090L_CONFIG_STREAM_SIZE];
+
+    /*! Bit set for every config program byte written since INIT_CTRL = 0 */
+    uint8_t config_written[BMI090L_CONFIG_STREAM_SIZE / 8];
+
+    /*! Config initialization in progress */
+    uint8_t asic_pending;
+
+    /*! Result of the pending config initialization */
+    uint8_t asic_result;
+
+    /*! Time at which the config initialization finishes */
+    uint64_t asic_done_ns;
+
+    /*! Time of the next data synchronization update */
+    uint64_t sync_next_ns;
+
+    /*! Gyro register map */
+    uint8_t gyro_reg[BMI090L_SIM_GYRO_REG_SIZE];
+
+    /*! Gyro registers are inaccessible until this time */
+    uint64_t gyro_boot_until_ns;
+
+    /*! Time of the next gyro sample */
+    uint64_t gyro_next_ns;
+
+    /*! Gyro self-test finishes at this time */
+    uint64_t gyro_self_test_ns;
+
+    /*! Gyro FIFO frames */
+    struct bmi090l_sensor_data gyro_fifo[BMI090L_SIM_GYRO_FIFO_FRAMES];
+
+    /*! Index of the oldest gyro FIFO frame */
+    uint8_t gyro_fifo_head;
+
+    /*! Number of frames in the gyro FIFO */
+    uint8_t gyro_fifo_count;
+
+    /*! Bytes already read from the oldest gyro FIFO frame */
+    uint8_t gyro_fifo_frame_rd;
+
+    /*! Gyro FIFO overrun flag */
+    uint8_t gyro_fifo_overrun;
+};
+
+/*********************************************************************/
+/* Function prototype declarations */
+
+/**
+ * \ingroup bmi090lSim
+ * \defgroup bmi090lSimApiInit Simulator setup
+ * @brief Power-on and attach the simulated device
+ */
+
+/*!
+ * \ingroup bmi090lSimApiInit
+ * \page bmi090l_sim_api_bmi090l_sim_init bmi090l_sim_init
+ * \code
+ * void bmi090l_sim_init(struct bmi090l_sim *sim, enum bmi090l_intf intf);
+ * \endcode
+ * @details This API puts the simulated accel and gyro in their power-on state
+ * and sets the default configuration of the model. The bus timing defaults to
+ * a 10 MHz SPI or a 400 kHz I2C bus depending on the interface.
+ *
+ *  @param[out] sim  : Simulator instance.
+ *  @param[in]  intf : Simulated interface.
+ */
+void bmi090l_sim_init(struct bmi090l_sim *sim, enum bmi090l_intf intf);
+
+/*!
+ * \ingroup bmi090lSimApiInit
+ * \page bmi090l_sim_api_bmi090l_sim_attach bmi090l_sim_attach
+ * \code
+ * void bmi090l_sim_attach(struct bmi090l_sim *sim, struct bmi090l_dev *dev);
+ * \endcode
+ * @details This API points the interface, bus callbacks and interface pointers
+ * of the device structure at the simulator. The vectored callback is left
+ * untouched, set dev->xfer to bmi090l_sim_xfer to use it.
+ *
+ *  @param[in]  sim : Simulator instance.
+ *  @param[out] dev : Structure instance of bmi090l_dev.
+ */
+void bmi090l_sim_attach(struct bmi090l_sim *sim, struct bmi090l_dev *dev);
+
+/**
+ * \ingroup bmi090lSim
+ * \defgroup bmi090lSimApiBus Simulator bus callbacks
+ * @brief Implementations of the bmi090l_dev bus callbacks
+ */
+
+/*!
+ * \ingroup bmi090lSimApiBus
+ * \page bmi090l_sim_api_bmi090l_sim_read bmi090l_sim_read
+ * \code
+ * BMI090L_INTF_RET_TYPE bmi090l_sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+ * \endcode
+ * @details Read callback, see bmi090l_read_fptr_t. On SPI the accel returns
+ * the dummy byte in front of the register data.
+ *
+ *  @param[in]  reg_addr : Register address, with the SPI read bit on SPI.
+ *  @param[out] reg_data : Data read.
+ *  @param[in]  len      : Number of bytes on the bus.
+ *  @param[in]  intf_ptr : Simulator port.
+ *
+ *  @retval 0 -> Success
+ *  @retval Non-zero -> Access rejected
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_read(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * \ingroup bmi090lSimApiBus
+ * \page bmi090l_sim_api_bmi090l_sim_write bmi090l_sim_write
+ * \code
+ * BMI090L_INTF_RET_TYPE bmi090l_sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+ * \endcode
+ * @details Write callback, see bmi090l_write_fptr_t.
+ *
+ *  @param[in] reg_addr : Register address.
+ *  @param[in] reg_data : Data to be written.
+ *  @param[in] len      : Number of bytes on the bus.
+ *  @param[in] intf_ptr : Simulator port.
+ *
+ *  @retval 0 -> Success
+ *  @retval Non-zero -> Access rejected
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_write(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, void *intf_ptr);
+
+/*!
+ * \ingroup bmi090lSimApiBus
+ * \page bmi090l_sim_api_bmi090l_sim_xfer bmi090l_sim_xfer
+ * \code
+ * BMI090L_INTF_RET_TYPE bmi090l_sim_xfer(const struct bmi090l_xfer_seg *seg, uint8_t count, void *intf_ptr);
+ * \endcode
+ * @details Vectored transfer callback, see bmi090l_xfer_fptr_t. The batch is
+ * charged one transaction overhead.
+ *
+ *  @param[in,out] seg      : Segments, processed in order.
+ *  @param[in]     count    : Number of segments.
+ *  @param[in]     intf_ptr : Simulator port.
+ *
+ *  @retval 0 -> Success
+ *  @retval Non-zero -> Access rejected, later segments are not performed
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_xfer(const struct bmi090l_xfer_seg *seg, uint8_t count, void *intf_ptr);
+
+/*!
+ * \ingroup bmi090lSimApiBus
+ * \page bmi090l_sim_api_bmi090l_sim_read_async bmi090l_sim_read_async
+ * \code
+ * BMI090L_INTF_RET_TYPE bmi090l_sim_read_async(uint8_t reg_addr,
+ *                                              uint8_t *reg_data,
+ *                                              uint32_t len,
+ *                                              void *intf_ptr,
+ *                                              struct bmi090l_fifo_xfer *xfer);
+ * \endcode
+ * @details Non-blocking read callback, see bmi090l_read_async_fptr_t. The
+ * read is performed at once and completion is reported to the driver before
+ * the callback returns.
+ *
+ *  @param[in]  reg_addr : Register address, with the SPI read bit on SPI.
+ *  @param[out] reg_data : Data read.
+ *  @param[in]  len      : Number of bytes on the bus.
+ *  @param[in]  intf_ptr : Simulator port.
+ *  @param[in]  xfer     : Transfer to complete.
+ *
+ *  @retval 0 -> Success
+ *  @retval Non-zero -> Transfer not started
+ */
+BMI090L_INTF_RET_TYPE bmi090l_sim_read_async(uint8_t reg_addr,
+                                             uint8_t *reg_data,
+                                             uint32_t len,
+                                             void *intf_ptr,
+                                             struct bmi090l_fifo_xfer *xfer);
+
+/*!
+ * \ingroup bmi090lSimApiBus
+ * \page bmi090l_sim_api_bmi090l_sim_delay_us bmi090l_sim_delay_us
+ * \code
+ * void bmi090l_sim_delay_us(uint32_t period, void *intf_ptr);
+ * \endcode
+ * @details Delay callback, see bmi090l_delay_us_fptr_t. Advances the virtual
+ * clock and returns immediately.
+ *
+ *  @param[in] period   : Delay in microseconds.
+ *  @param[in] intf_ptr : Simulator port.
+ */
+void bmi090l_sim_delay_us(uint32_t period, void *intf_ptr);
+
+/**
+ * \ingroup bmi090lSim
+ * \defgroup bmi090lSimApiTime Simulator clock
+ * @brief Access to the virtual clock
+ */
+
+/*!
+ * \ingroup bmi090lSimApiTime
+ * \page bmi090l_sim_api_bmi090l_sim_advance_us bmi090l_sim_advance_us
+ * \code
+ * void bmi090l_sim_advance_us(struct bmi090l_sim *sim, uint32_t period);
+ * \endcode
+ * @details This API lets time pass outside of driver calls, e.g. to model
+ * host processing between two FIFO reads.
+ *
+ *  @param[in,out] sim    : Simulator instance.
+ *  @param[in]     period : Time in microseconds.
+ */
+void bmi090l_sim_advance_us(struct bmi090l_sim *sim, uint32_t period);
+
+/*!
+ * \ingroup bmi090lSimApiTime
+ * \page bmi090l_sim_api_bmi090l_sim_get_time_ns bmi090l_sim_get_time_ns
+ * \code
+ * uint64_t bmi090l_sim_get_time_ns(const struct bmi090l_sim *sim);
+ * \endcode
+ * @details This API returns the virtual time since bmi090l_sim_init().
+ *
+ *  @param[in] sim : Simulator instance.
+ *
+ *  @return Virtual time in nanoseconds
+ */
+uint64_t bmi090l_sim_get_time_ns(const struct bmi090l_sim *sim);
+
+/*!
+ * \ingroup bmi090lSimApiTime
+ * \page bmi090l_sim_api_bmi090l_sim_timestamp_us bmi090l_sim_timestamp_us
+ * \code
+ * uint32_t bmi090l_sim_timestamp_us(void *intf_ptr);
+ * \endcode
+ * @details Timestamp callback of the bus statistics, see
+ * bmi090l_timestamp_us_fptr_t. Attached by bmi090l_sim_attach() when built
+ * with BMI090L_BUS_STATS.
+ *
+ *  @param[in] intf_ptr : Simulator port.
+ *
+ *  @return Virtual time in microseconds, wrapping at 2^32
+ */
+uint32_t bmi090l_sim_timestamp_us(void *intf_ptr);
+
+#ifdef __cplusplus
+}
+#endif /* End of CPP guard */
+
+#endif /* BMI090L_SIM_H_ */
@@ -432,6 +432,44 @@ static int8_t null_ptr_check(const struct bmi090l_dev *dev);
  */
 static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev);
 
+/*!
+ * @brief This API reads the data from the given register address, keeping
+ * the dummy byte at the start of the buffer.
+ *
+ * @param[in] reg_addr  : Register address from where the data to be read
+ * @param[out] buff     : Buffer of len + dummy byte length, data starts after the dummy byte
+ * @param[in] len       : No. of bytes of data to be read.
+ * @param[in] dev       : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_regs_in_place(uint8_t reg_addr, uint8_t *buff, uint32_t len, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the number of dummy bytes returned by the read
+ * callback, taking the dummy byte mode into account.
+ *
+ * @param[in] dev : Structure instance of bmi090l_dev.
+ *
+ * @return Number of leading dummy bytes
+ */
+static uint8_t get_dummy_len(const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the accel FIFO enable bit, reading the register
+ * only when the cached value is unknown.
+ *
+ * @param[out] accel_en : FIFO enable bit, BMI090L_ACCEL_EN_MASK when enabled.
+ * @param[in]  dev      : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_fifo_accel_en(uint8_t *accel_en, struct bmi090l_dev *dev);
+
 /*!
  *  @brief This API writes the given data to the register address of accel sensor.
  *
@@ -459,6 +497,231 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
  */
 static int8_t set_int_pin_config(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev);
 
+/*!
+ * @brief This API updates an interrupt pin configuration register value with
+ * the user settings.
+ *
+ * @param[in] int_config  : Structure instance of bmi090l_accel_int_channel_cfg.
+ * @param[in] data        : Current register value.
+ *
+ * @return Updated register value
+ */
+static uint8_t get_int_pin_conf(const struct bmi090l_accel_int_channel_cfg *int_config, uint8_t data);
+
+/*!
+ * @brief This API maps or unmaps an interrupt and configures the interrupt
+ * pin, reading and writing both registers in one batch each.
+ *
+ * @param[in] int_config  : Structure instance of bmi090l_accel_int_channel_cfg.
+ * @param[in] map_addr    : Interrupt map register.
+ * @param[in] map_mask    : Bit of the interrupt in the map register.
+ * @param[in] enable      : Map (non-zero) or unmap (zero) the interrupt.
+ * @param[in] dev         : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_int_map(const struct bmi090l_accel_int_channel_cfg *int_config,
+                          uint8_t map_addr,
+                          uint8_t map_mask,
+                          uint8_t enable,
+                          struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API maps or unmaps a feature interrupt on INT1 or INT2.
+ *
+ * @param[in] int_config  : Structure instance of bmi090l_accel_int_channel_cfg.
+ * @param[in] map_mask    : Bit of the interrupt in the INT1/INT2 map register.
+ * @param[in] dev         : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t set_feature_int_map(const struct bmi090l_accel_int_channel_cfg *int_config,
+                                  uint8_t map_mask,
+                                  struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API performs a list of register transactions. With a vectored
+ * callback the list is submitted in one call, otherwise each segment is
+ * performed through the read and write callbacks.
+ *
+ * @param[in,out] seg   : Segments with plain register addresses.
+ * @param[in]     count : Number of segments.
+ * @param[in]     dev   : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t xfer_regs(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API performs a list of register transactions on the bus,
+ * without the shadow register cache.
+ *
+ * @param[in,out] seg   : Segments with plain register addresses.
+ * @param[in]     count : Number of segments.
+ * @param[in]     dev   : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t xfer_regs_bus(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the shadow cache index of a register.
+ *
+ * @param[in] reg_addr : Register address.
+ *
+ * @return Index in the accel shadow, BMI090L_SHADOW_ACCEL_LEN if not cached
+ */
+static uint8_t shadow_index(uint8_t reg_addr);
+
+/*!
+ * @brief This API answers a register read from the shadow cache.
+ *
+ * @param[in]  reg_addr : Register address from where the data to be read.
+ * @param[out] data     : Data read.
+ * @param[in]  len      : No. of bytes of data to be read.
+ * @param[in]  dev      : Structure instance of bmi090l_dev.
+ *
+ * @return TRUE if all bytes were answered from the cache, FALSE otherwise
+ */
+static uint8_t shadow_get(uint8_t reg_addr, uint8_t *data, uint32_t len, const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API updates the shadow cache after a successful register read
+ * or write. A soft reset command invalidates the cache.
+ *
+ * @param[in] reg_addr : Register address.
+ * @param[in] data     : Data read from or written to the sensor.
+ * @param[in] len      : No. of bytes.
+ * @param[in] dir      : BMI090L_XFER_READ or BMI090L_XFER_WRITE.
+ * @param[in] dev      : Structure instance of bmi090l_dev.
+ */
+static void shadow_store(uint8_t reg_addr, const uint8_t *data, uint32_t len, uint8_t dir, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API reads all cached registers into the shadow cache.
+ *
+ * @param[in] dev : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t shadow_fill(struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API loads the feature configuration space into the RAM image
+ * of the device structure, if not yet known.
+ *
+ * @param[in] dev : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t feature_load(struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API reads words of the feature configuration from the RAM image.
+ *
+ * @param[in]  word : Index of the first word.
+ * @param[out] data : Feature configuration words.
+ * @param[in]  len  : Number of words.
+ * @param[in]  dev  : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t feature_get_words(uint8_t word, uint16_t *data, uint8_t len, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API updates a word of the RAM image and marks it dirty if it
+ * changed. The read-only config ID word is left untouched.
+ *
+ * @param[in] word  : Index of the word.
+ * @param[in] value : New value.
+ * @param[in] dev   : Structure instance of bmi090l_dev.
+ */
+static void feature_set_word(uint8_t word, uint16_t value, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API writes the dirty words of the RAM image to the sensor.
+ *
+ * @param[in] dev : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t feature_flush(struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API waits until a masked accel register reads the given value.
+ * With BMI090L_WAIT_FIXED it sleeps the full timeout instead. A poll timing
+ * out or failing is not an error, the caller checks the sensor state as it
+ * does after the fixed delay.
+ *
+ * @param[in] reg_addr   : Register address.
+ * @param[in] mask       : Mask applied to the register value.
+ * @param[in] value      : Masked value of a ready sensor.
+ * @param[in] timeout_us : Worst-case time until the sensor is ready.
+ * @param[in] dev        : Structure instance of bmi090l_dev.
+ */
+static void wait_ready(uint8_t reg_addr, uint8_t mask, uint8_t value, uint32_t timeout_us, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API is the non-blocking counterpart of wait_ready(). The first
+ * call starts the wait, later calls poll the register with BMI090L_WAIT_POLL.
+ *
+ * @param[in,out] ctx     : Initialization context.
+ * @param[in] reg_addr    : Register address.
+ * @param[in] mask        : Mask applied to the register value.
+ * @param[in] value       : Masked value of a ready sensor.
+ * @param[in] timeout_us  : Worst-case time until the sensor is ready.
+ * @param[out] wait_us    : Time until the next call, 0 once the wait is over.
+ * @param[in] dev         : Structure instance of bmi090l_dev.
+ *
+ * @return TRUE once the sensor is ready or the timeout has passed
+ */
+static uint8_t init_wait(struct bmi090l_init_ctx *ctx,
+                         uint8_t reg_addr,
+                         uint8_t mask,
+                         uint8_t value,
+                         uint32_t timeout_us,
+                         uint32_t *wait_us,
+                         struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the first state of the next initialization step
+ * selected by the user, starting at the given step.
+ *
+ * @param[in] steps : Selected BMI090L_INIT_* steps.
+ * @param[in] state : First state of the candidate step.
+ *
+ * @return Next initialization state
+ */
+static uint8_t init_next(uint8_t steps, uint8_t state);
+
+/*!
+ * @brief This API returns the register values of the requested accel power mode.
+ *
+ * @param[in] power_mode : BMI090L_ACCEL_PM_ACTIVE or BMI090L_ACCEL_PM_SUSPEND.
+ * @param[out] data      : Values of the PWR_CONF and PWR_CTRL registers.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t get_power_regs(uint8_t power_mode, uint8_t *data);
+
 /*!
  * @brief This API sets the data ready interrupt for accel sensor
  *
@@ -604,6 +867,18 @@ static void unpack_accel_data(struct bmi090l_sensor_data *acc,
                               uint16_t data_start_indx,
                               const struct bmi090l_fifo_frame *fifo);
 
+/*!
+ * @brief This internal API decodes the x, y and z data of an accel FIFO
+ * frame, the 6 bytes following the frame header.
+ *
+ * @param[out] acc  : Structure instance of bmi090l_sensor_data.
+ * @param[in]  data : Accel data bytes of the frame.
+ *
+ * @return None
+ * @retval None
+ */
+static inline void decode_accel_xyz(struct bmi090l_sensor_data *acc, const uint8_t *data);
+
 /*!
  * @brief This internal API is used to parse the accelerometer data from the
  * FIFO data in both header and header-less mode. It updates the current data
@@ -700,6 +975,162 @@ static int8_t extract_acc_header_mode(struct bmi090l_sensor_data *acc,
                                       uint16_t *accel_length,
                                       struct bmi090l_fifo_frame *fifo);
 
+/*!
+ * @brief This internal API parses a run of complete accel-only frames from
+ * the FIFO data, stopping at the first other header, at an incomplete frame
+ * or when the accel array is full.
+ *
+ * @param[out]    acc     : Structure instance of bmi090l_sensor_data where
+ *                          the parsed data bytes are stored.
+ * @param[in,out] idx     : Index of the first frame header, updated to the
+ *                          first byte behind the run.
+ * @param[in,out] acc_idx : Index of the next accelerometer frame.
+ * @param[in]     acc_len : Size of the accel array.
+ * @param[in]     fifo    : Structure instance of bmi090l_fifo_frame.
+ *
+ * @return None
+ * @retval None
+ */
+static void unpack_accel_run(struct bmi090l_sensor_data *acc,
+                             uint16_t *idx,
+                             uint16_t *acc_idx,
+                             uint16_t acc_len,
+                             const struct bmi090l_fifo_frame *fifo);
+
+/*!
+ * @brief This internal API returns the length of an accel FIFO frame.
+ *
+ * @param[in] header : Frame header.
+ *
+ * @return Frame length including the header, 0 at the end of the FIFO data
+ * or on an invalid header
+ */
+static uint8_t get_fifo_frame_len(uint8_t header);
+
+/*!
+ * @brief This internal API parses one complete accel FIFO frame for the
+ * streaming parser.
+ *
+ * @param[in,out] parser    : Structure instance of bmi090l_fifo_parser.
+ * @param[in]     frame     : Frame, starting with the header.
+ * @param[out]    acc       : Array of bmi090l_sensor_data.
+ * @param[in,out] acc_idx   : Index of the next accel sample.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void parse_fifo_frame(struct bmi090l_fifo_parser *parser,
+                             const uint8_t *frame,
+                             struct bmi090l_sensor_data *acc,
+                             uint16_t *acc_idx);
+
+/*!
+ * @brief This internal API decodes the accel FIFO frame at the parse index
+ * into an event and moves the index past it.
+ *
+ * @param[out] event : Structure instance of bmi090l_fifo_event.
+ * @param[in]  fifo  : Structure instance of bmi090l_fifo_frame.
+ * @param[in]  dev   : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI090L_W_FIFO_EMPTY -> No complete frame left, the index is unchanged
+ */
+static int8_t get_fifo_event(struct bmi090l_fifo_event *event,
+                             struct bmi090l_fifo_frame *fifo,
+                             const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This internal API converts sensor time ticks to ns.
+ *
+ * @param[in] sensor_time : Extended sensor time.
+ *
+ * @return Time in ns
+ */
+static uint64_t sensor_time_to_ns(uint64_t sensor_time);
+
+/*!
+ * @brief This internal API returns the gyro sample period of a gyro
+ * bandwidth/ODR setting.
+ *
+ * @param[in] odr : BMI090L_GYRO_BW_*.
+ *
+ * @return Sample period in ns, 0 for an invalid setting
+ */
+static uint32_t get_gyro_period_ns(uint8_t odr);
+
+/*!
+ * @brief This internal API estimates the time of the last gyro sample of a
+ * gyro FIFO read from the accel sensor time of the same FIFO drain.
+ *
+ * @param[in]     gyro_length : Gyro samples read.
+ * @param[in,out] merger      : Structure instance of bmi090l_fifo_merger.
+ * @param[in]     dev         : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval BMI090L_W_NO_SENSOR_TIME -> No sensor time yet
+ * @retval < 0 -> Fail
+ */
+static int8_t estimate_gyro_time(uint16_t gyro_length,
+                                 struct bmi090l_fifo_merger *merger,
+                                 const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This internal API interpolates linearly between two samples.
+ *
+ * @param[in]  prev    : Earlier sample.
+ * @param[in]  next    : Later sample.
+ * @param[in]  time_ns : Time to interpolate at.
+ * @param[out] data    : Interpolated data.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void interpolate_sample(const struct bmi090l_fifo_sample *prev,
+                               const struct bmi090l_fifo_sample *next,
+                               uint64_t time_ns,
+                               struct bmi090l_sensor_data *data);
+
+/*!
+ * @brief This internal API emits the oldest pending grid point of the
+ * resampler. A sensor without data for it holds its last sample.
+ *
+ * @param[in,out] resampler : Structure instance of bmi090l_fifo_resampler.
+ * @param[out]    imu_data  : Grid point.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void resampler_emit(struct bmi090l_fifo_resampler *resampler, struct bmi090l_imu_sample *imu_data);
+
+/*!
+ * @brief This internal API returns the FIFO watermark leaving room for the
+ * frames of the given time.
+ *
+ * @param[in] margin_ns : Time to leave room for.
+ * @param[in] period_ns : Frame period.
+ * @param[in] capacity  : FIFO capacity in frames.
+ *
+ * @return Watermark in frames, at least one
+ */
+static uint16_t get_fifo_wm_frames(uint64_t margin_ns, uint64_t period_ns, uint16_t capacity);
+
+/*!
+ * @brief This internal API decides whether a new watermark is written:
+ * always when it is lower, when higher only beyond the hysteresis.
+ *
+ * @param[in] wm       : Current watermark.
+ * @param[in] new_wm   : New watermark.
+ * @param[in] capacity : FIFO capacity, in the unit of the watermark.
+ *
+ * @return TRUE to write the new watermark
+ */
+static uint8_t fifo_wm_changed(uint16_t wm, uint16_t new_wm, uint16_t capacity);
+
 /*!
  * @brief This API sets the FIFO watermark interrupt for accel sensor
  *
@@ -811,14 +1242,31 @@ static int8_t set_remap_axes(const struct bmi090l_axes_remap *remap, struct bmi0
 /*!
  * @brief This internal API gets the re-mapped accelerometer/gyroscope data.
  *
- * @param[out] data         : Structure instance of bmi090l_sensor_data.
- * @param[in]  dev          : Structure instance of bmi090l_dev.
+ * @param[in,out] data      : Array of bmi090l_sensor_data, re-mapped in place.
+ * @param[in]     count     : Number of samples.
+ * @param[in]     dev       : Structure instance of bmi090l_dev.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void get_remapped_data(struct bmi090l_sensor_data *data, uint16_t count, const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This internal API appends one sample to a sample ring, overwriting
+ * the oldest entry once the ring is full.
+ *
+ * @param[in,out] ring    : Sample ring.
+ * @param[in]     data    : Sample to append.
+ * @param[in]     time_us : Timestamp of the sample, stored if ring->time_us is set.
  *
  * @return None
  *
  * @retval None
  */
-static void get_remapped_data(struct bmi090l_sensor_data *data, const struct bmi090l_dev *dev);
+static void sample_ring_put(struct bmi090l_sample_ring *ring,
+                            const struct bmi090l_sensor_data *data,
+                            uint32_t time_us);
 
 /*!
  * @brief This internal API is to store re-mapped axis and sign values
@@ -875,6 +1323,47 @@ static int8_t write_config_file(struct bmi090l_dev *dev);
 /**\name        Function definitions
  ****************************************************************************/
 
+/*!
+ *  @brief This API sets the optional members of the device structure to
+ *  their defaults.
+ */
+int8_t bmi090l_set_dev_defaults(struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+
+    if (dev != NULL)
+    {
+        dev->dummy_byte_mode = BMI090L_DUMMY_BYTE_COPY;
+        dev->xfer = NULL;
+        dev->read_async = NULL;
+        dev->accel_fifo_en = BMI090L_FIFO_EN_UNKNOWN;
+        dev->wait_mode = BMI090L_WAIT_FIXED;
+        dev->shadow.enable = BMI090L_DISABLE;
+        dev->shadow.accel_valid = 0;
+        dev->shadow.gyro_valid = 0;
+        dev->feature.dirty = 0;
+        dev->feature.valid = FALSE;
+        dev->feature.staged = FALSE;
+#ifdef BMI090L_BUS_STATS
+        dev->stats = NULL;
+#endif
+        dev->timestamp_us = NULL;
+        dev->remap.x_axis = BMI090L_MAP_X_AXIS;
+        dev->remap.x_axis_sign = BMI090L_MAP_POSITIVE;
+        dev->remap.y_axis = BMI090L_MAP_Y_AXIS;
+        dev->remap.y_axis_sign = BMI090L_MAP_POSITIVE;
+        dev->remap.z_axis = BMI090L_MAP_Z_AXIS;
+        dev->remap.z_axis_sign = BMI090L_MAP_POSITIVE;
+        dev->ext_key = BMI090L_DEV_EXT_KEY;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
 /*!
  *  @brief This API is the entry point for accel sensor.
  *  It performs the selection of I2C/SPI read mechanism according to the
@@ -885,12 +1374,24 @@ int8_t bmi090la_init(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t chip_id = 0;
 
+    /* Without the opt-in key the optional members may hold garbage, see bmi090l_dev.ext_key */
+    if ((dev != NULL) && (dev->ext_key != BMI090L_DEV_EXT_KEY))
+    {
+        (void)bmi090l_set_dev_defaults(dev);
+    }
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_INIT);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
     /* Proceed if null check is fine */
     if (rslt == BMI090L_OK)
     {
+        dev->accel_fifo_en = BMI090L_FIFO_EN_UNKNOWN;
+        dev->feature.valid = FALSE;
+        dev->feature.staged = FALSE;
+
         if (dev->intf == BMI090L_SPI_INTF)
         {
             /* Set dummy byte in case of SPI interface */
@@ -910,8 +1411,15 @@ int8_t bmi090la_init(struct bmi090l_dev *dev)
             /* Get chip ID of sensor */
             rslt = get_chip_id(dev);
         }
+
+        if (rslt == BMI090L_OK)
+        {
+            rslt = shadow_fill(dev);
+        }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -926,6 +1434,8 @@ int8_t bmi090la_apply_config_file(struct bmi090l_dev *dev)
     uint8_t config_load = BMI090L_DISABLE;
     uint8_t aps_disable = BMI090L_DISABLE;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_APPLY_CONFIG_FILE);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -935,6 +1445,10 @@ int8_t bmi090la_apply_config_file(struct bmi090l_dev *dev)
         /* Assign stream file */
         dev->config_file_ptr = bmi090l_config_file;
 
+        /* The upload replaces the feature configuration and drops an open transaction */
+        dev->feature.valid = FALSE;
+        dev->feature.staged = FALSE;
+
         /* Check whether the read/write length is valid */
         if (dev->read_write_len > 0)
         {
@@ -964,6 +1478,315 @@ int8_t bmi090la_apply_config_file(struct bmi090l_dev *dev)
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API prepares the non-blocking initialization of the accel sensor.
+ */
+int8_t bmi090la_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    /* Without the opt-in key the optional members may hold garbage, see bmi090l_dev.ext_key */
+    if ((dev != NULL) && (dev->ext_key != BMI090L_DEV_EXT_KEY))
+    {
+        (void)bmi090l_set_dev_defaults(dev);
+    }
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_INIT_START);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && (ctx != NULL))
+    {
+        ctx->steps = steps;
+        ctx->state = BMI090L_INIT_STATE_START;
+        ctx->index = 0;
+        ctx->waited_us = 0;
+        ctx->backoff_us = 0;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API runs the next step of the non-blocking initialization of
+ *  the accel sensor.
+ */
+int8_t bmi090la_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data = 0;
+    uint8_t power[2] = { 0 };
+    uint8_t stale[6];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_INIT_STEP);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && ((ctx == NULL) || (wait_us == NULL)))
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        *wait_us = 0;
+
+        switch (ctx->state)
+        {
+            case BMI090L_INIT_STATE_START:
+
+                /* Interface selection and chip ID check */
+                rslt = bmi090la_init(dev);
+                ctx->state = init_next(ctx->steps, BMI090L_INIT_STATE_RESET);
+                break;
+
+            case BMI090L_INIT_STATE_RESET:
+
+                /* Reset accel device */
+                data = BMI090L_SOFT_RESET_CMD;
+                rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_SOFTRESET, &data, 1, dev);
+                ctx->state = BMI090L_INIT_STATE_RESET_WAIT;
+                *wait_us = BMI090L_ACCEL_SOFTRESET_DELAY_MS * 1000;
+                break;
+
+            case BMI090L_INIT_STATE_RESET_WAIT:
+
+                /* Dummy SPI read of Chip-ID to switch the accel back to SPI */
+                if (dev->intf == BMI090L_SPI_INTF)
+                {
+                    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_CHIP_ID, &data, 1, dev);
+                }
+
+                if (rslt == BMI090L_OK)
+                {
+                    /* The reset cleared the shadow cache, read back the reset values */
+                    rslt = shadow_fill(dev);
+                }
+
+                ctx->state = init_next(ctx->steps, BMI090L_INIT_STATE_CONFIG);
+                break;
+
+            case BMI090L_INIT_STATE_CONFIG:
+                if (dev->read_write_len > 0)
+                {
+                    /* The upload replaces the feature configuration and drops an open transaction */
+                    dev->config_file_ptr = bmi090l_config_file;
+                    dev->feature.valid = FALSE;
+                    dev->feature.staged = FALSE;
+
+                    /* Disable advanced power save mode */
+                    data = BMI090L_DISABLE;
+                    rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_PWR_CONF, &data, 1, dev);
+                    ctx->index = 0;
+                    ctx->state = BMI090L_INIT_STATE_CONFIG_STREAM;
+                    *wait_us = 450;
+                }
+                else
+                {
+                    rslt = BMI090L_E_RD_WR_LENGTH_INVALID;
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_CONFIG_STREAM:
+                if (ctx->index == 0)
+                {
+                    /* Config loading disable */
+                    data = BMI090L_DISABLE;
+                    rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_INIT_CTRL, &data, 1, dev);
+                }
+
+                if (rslt == BMI090L_OK)
+                {
+                    /* One chunk of the config stream per step */
+                    rslt = stream_transfer_write(dev->config_file_ptr + ctx->index, ctx->index, dev);
+                    ctx->index += dev->read_write_len;
+                }
+
+                if ((rslt == BMI090L_OK) && (ctx->index >= BMI090L_CONFIG_STREAM_SIZE))
+                {
+                    /* Enable config loading and wait till ASIC is initialized */
+                    data = BMI090L_ENABLE;
+                    rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_INIT_CTRL, &data, 1, dev);
+                    ctx->state = BMI090L_INIT_STATE_CONFIG_WAIT;
+                    (void)init_wait(ctx,
+                                    BMI090L_REG_ACCEL_INTERNAL_STAT,
+                                    0xFF,
+                                    BMI090L_ASIC_INITIALIZED,
+                                    (uint32_t)BMI090L_ASIC_INIT_TIME_MS * 1000,
+                                    wait_us,
+                                    dev);
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_CONFIG_WAIT:
+                if (init_wait(ctx, BMI090L_REG_ACCEL_INTERNAL_STAT, 0xFF, BMI090L_ASIC_INITIALIZED,
+                              (uint32_t)BMI090L_ASIC_INIT_TIME_MS * 1000, wait_us, dev))
+                {
+                    /* Check for config initialization status (1 = OK) */
+                    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INTERNAL_STAT, &data, 1, dev);
+
+                    if ((rslt == BMI090L_OK) && (data != BMI090L_ASIC_INITIALIZED))
+                    {
+                        rslt = BMI090L_E_CONFIG_STREAM_ERROR;
+                    }
+
+                    ctx->state = init_next(ctx->steps, BMI090L_INIT_STATE_POWER);
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_POWER:
+                rslt = get_power_regs(dev->accel_cfg.power, power);
+
+                if (rslt == BMI090L_OK)
+                {
+                    rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_PWR_CONF, &power[0], 1, dev);
+                    ctx->state = BMI090L_INIT_STATE_POWER_CTRL;
+                    *wait_us = BMI090L_POWER_CONFIG_DELAY * 1000;
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_POWER_CTRL:
+                rslt = get_power_regs(dev->accel_cfg.power, power);
+
+                if ((rslt == BMI090L_OK) && (dev->wait_mode == BMI090L_WAIT_POLL) &&
+                    (dev->accel_cfg.power == BMI090L_ACCEL_PM_ACTIVE))
+                {
+                    /* Clear a stale data ready flag by reading the data registers */
+                    rslt = get_regs(BMI090L_REG_ACCEL_X_LSB, stale, sizeof(stale), dev);
+                }
+
+                if (rslt == BMI090L_OK)
+                {
+                    rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_PWR_CTRL, &power[1], 1, dev);
+                    ctx->state = BMI090L_INIT_STATE_POWER_WAIT;
+                }
+
+                if ((rslt == BMI090L_OK) && (dev->accel_cfg.power == BMI090L_ACCEL_PM_ACTIVE))
+                {
+                    /* Wait for the first sample, at most the power mode switch delay */
+                    (void)init_wait(ctx,
+                                    BMI090L_REG_ACCEL_STATUS,
+                                    BMI090L_ACCEL_STATUS_MASK,
+                                    BMI090L_ACCEL_STATUS_MASK,
+                                    BMI090L_POWER_CONFIG_DELAY * 1000,
+                                    wait_us,
+                                    dev);
+                }
+                else if (rslt == BMI090L_OK)
+                {
+                    /* Delay required to switch power modes */
+                    *wait_us = BMI090L_POWER_CONFIG_DELAY * 1000;
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_POWER_WAIT:
+                if ((dev->accel_cfg.power != BMI090L_ACCEL_PM_ACTIVE) ||
+                    init_wait(ctx, BMI090L_REG_ACCEL_STATUS, BMI090L_ACCEL_STATUS_MASK, BMI090L_ACCEL_STATUS_MASK,
+                              BMI090L_POWER_CONFIG_DELAY * 1000, wait_us, dev))
+                {
+                    ctx->state = BMI090L_INIT_STATE_DONE;
+                }
+
+                break;
+
+            default:
+                break;
+        }
+
+        if (rslt != BMI090L_OK)
+        {
+            /* Stop, the initialization has to be started again */
+            ctx->state = BMI090L_INIT_STATE_DONE;
+            ctx->backoff_us = 0;
+            *wait_us = 0;
+        }
+        else if (ctx->state != BMI090L_INIT_STATE_DONE)
+        {
+            rslt = BMI090L_W_IN_PROGRESS;
+        }
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API skips the config file upload if the sensor already runs it.
+ */
+int8_t bmi090la_warm_apply_config_file(uint16_t config_major,
+                                       uint16_t config_minor,
+                                       uint8_t *uploaded,
+                                       struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t internal_stat = 0;
+    uint16_t loaded_major = 0;
+    uint16_t loaded_minor = 0;
+    uint8_t loaded = FALSE;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_WARM_APPLY_CONFIG_FILE);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && (uploaded != NULL))
+    {
+        /* Check for config initialization status (1 = OK) */
+        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INTERNAL_STAT, &internal_stat, 1, dev);
+
+        if ((rslt == BMI090L_OK) && (internal_stat == BMI090L_ASIC_INITIALIZED))
+        {
+            /* Compare the loaded config ID with the one read back after an earlier upload */
+            dev->feature.valid = FALSE;
+            rslt = bmi090la_get_version_config(&loaded_major, &loaded_minor, dev);
+
+            if ((rslt == BMI090L_OK) && (loaded_major == config_major) && (loaded_minor == config_minor))
+            {
+                loaded = TRUE;
+            }
+        }
+
+        if ((rslt == BMI090L_OK) && loaded)
+        {
+            dev->config_file_ptr = bmi090l_config_file;
+            dev->feature.staged = FALSE;
+
+            /* The remap used for data conversion is kept by the sensor */
+            rslt = get_remap_axes(&dev->remap, dev);
+        }
+        else if (rslt == BMI090L_OK)
+        {
+            rslt = bmi090la_apply_config_file(dev);
+        }
+
+        *uploaded = !loaded;
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -972,29 +1795,119 @@ int8_t bmi090la_apply_config_file(struct bmi090l_dev *dev)
  */
 int8_t bmi090la_write_feature_config(uint8_t reg_addr, const uint16_t *reg_data, uint8_t len, struct bmi090l_dev *dev)
 {
-
     int8_t rslt;
-    uint16_t read_length = (reg_addr * 2) + (len * 2);
-    uint8_t feature_data[read_length];
-    uint8_t indx = 0;
+    uint8_t indx;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_WRITE_FEATURE_CONFIG);
+
+    /* Load the feature space image if not yet known */
+    rslt = feature_load(dev);
 
-    /* Read feature space up to the given feature position */
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, &feature_data[0], read_length, dev);
+    if ((rslt == BMI090L_OK) && (reg_data == NULL))
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+    else if ((rslt == BMI090L_OK) && ((reg_addr + len) > BMI090L_FEATURE_WORDS))
+    {
+        rslt = BMI090L_E_INVALID_INPUT;
+    }
 
     if (rslt == BMI090L_OK)
     {
-        /* Apply the given feature config. */
+        /* Apply the given feature config, the feature config space is 16bit aligned */
         for (indx = 0; indx < len; ++indx)
         {
-            /* Be careful: the feature config space is 16bit aligned! */
-            feature_data[(reg_addr * 2) + (indx * 2)] = reg_data[indx] & 0xFF;
-            feature_data[(reg_addr * 2) + (indx * 2) + 1] = reg_data[indx] >> 8;
+            feature_set_word(reg_addr + indx, reg_data[indx], dev);
+        }
+
+        /* Write back the changed part of the feature space, unless held for a transaction commit */
+        if (!dev->feature.staged)
+        {
+            rslt = feature_flush(dev);
         }
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API opens a feature configuration transaction.
+ */
+int8_t bmi090la_feature_config_begin(struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_BEGIN);
+
+    /* Stage on top of the current feature space */
+    rslt = feature_load(dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->feature.staged = TRUE;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API writes the staged feature configuration in a single burst.
+ */
+int8_t bmi090la_feature_config_commit(struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_COMMIT);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && !dev->feature.staged)
+    {
+        rslt = BMI090L_E_INVALID_CONFIG;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->feature.staged = FALSE;
+        rslt = feature_flush(dev);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API discards the staged feature configuration.
+ */
+int8_t bmi090la_feature_config_abort(struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_FEATURE_CONFIG_ABORT);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->feature.staged = FALSE;
 
-        /* Write back updated feature space */
-        rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, &feature_data[0], read_length, dev);
+        if (dev->feature.dirty)
+        {
+            /* Drop the image, and restore the remap used for data conversion */
+            dev->feature.valid = FALSE;
+            rslt = get_remap_axes(&dev->remap, dev);
+        }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1005,6 +1918,8 @@ int8_t bmi090la_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, stru
 {
     int8_t rslt;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_REGS);
+
     /* Check for null pointer in the device structure*/
     rslt = null_ptr_check(dev);
 
@@ -1026,6 +1941,8 @@ int8_t bmi090la_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, stru
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1037,6 +1954,8 @@ int8_t bmi090la_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len
 {
     int8_t rslt;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_REGS);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -1047,6 +1966,20 @@ int8_t bmi090la_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len
         {
             /* Writing to the register */
             rslt = set_regs(reg_addr, reg_data, len, dev);
+
+            /* FIFO configuration or soft-reset written by the caller */
+            if (((reg_addr <= BMI090L_FIFO_CONFIG_1_ADDR) && ((reg_addr + len) > BMI090L_FIFO_CONFIG_1_ADDR)) ||
+                (reg_addr == BMI090L_REG_ACCEL_SOFTRESET))
+            {
+                dev->accel_fifo_en = BMI090L_FIFO_EN_UNKNOWN;
+            }
+
+            /* Feature space written by the caller or config file upload, or soft-reset */
+            if ((reg_addr == BMI090L_REG_ACCEL_FEATURE_CFG) || (reg_addr == BMI090L_REG_ACCEL_SOFTRESET))
+            {
+                dev->feature.valid = FALSE;
+                dev->feature.staged = FALSE;
+            }
         }
         else
         {
@@ -1058,6 +1991,8 @@ int8_t bmi090la_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1069,6 +2004,8 @@ int8_t bmi090la_get_error_status(struct bmi090l_err_reg *err_reg, struct bmi090l
     int8_t rslt;
     uint8_t data = 0;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_ERROR_STATUS);
+
     if (err_reg != NULL)
     {
         /* Read the error codes */
@@ -1088,6 +2025,8 @@ int8_t bmi090la_get_error_status(struct bmi090l_err_reg *err_reg, struct bmi090l
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1099,6 +2038,8 @@ int8_t bmi090la_get_status(uint8_t *status, struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data = 0;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_STATUS);
+
     /* Proceed if null check is fine */
     if (status != NULL)
     {
@@ -1116,6 +2057,8 @@ int8_t bmi090la_get_status(uint8_t *status, struct bmi090l_dev *dev)
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1127,6 +2070,8 @@ int8_t bmi090la_soft_reset(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data = BMI090L_SOFT_RESET_CMD;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SOFT_RESET);
+
     /* Reset accel device */
     rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_SOFTRESET, &data, 1, dev);
 
@@ -1143,8 +2088,16 @@ int8_t bmi090la_soft_reset(struct bmi090l_dev *dev)
             /* Dummy SPI read operation of Chip-ID */
             rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_CHIP_ID, &data, 1, dev);
         }
+
+        if (rslt == BMI090L_OK)
+        {
+            /* The reset cleared the shadow cache, read back the reset values */
+            rslt = shadow_fill(dev);
+        }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1158,6 +2111,8 @@ int8_t bmi090la_get_meas_conf(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data[2];
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_MEAS_CONF);
+
     rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_CONF, data, 2, dev);
 
     if (rslt == BMI090L_OK)
@@ -1167,6 +2122,8 @@ int8_t bmi090la_get_meas_conf(struct bmi090l_dev *dev)
         dev->accel_cfg.range = data[1] & BMI090L_ACCEL_RANGE_MASK;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1180,6 +2137,9 @@ int8_t bmi090la_set_meas_conf(struct bmi090l_dev *dev)
     uint8_t data[2] = { 0 };
     uint8_t bw, range, odr;
     uint8_t is_odr_invalid = FALSE, is_bw_invalid = FALSE, is_range_invalid = FALSE;
+    struct bmi090l_xfer_seg seg;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_MEAS_CONF);
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
@@ -1215,8 +2175,12 @@ int8_t bmi090la_set_meas_conf(struct bmi090l_dev *dev)
         /* If ODR, BW and Range are valid, write it to accel config. registers */
         if ((!is_odr_invalid) && (!is_bw_invalid) && (!is_range_invalid))
         {
-            /* Read accel config. register */
-            rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_CONF, data, 2, dev);
+            /* Read accel config. and range registers, from the shadow cache when enabled */
+            seg.reg_addr = BMI090L_REG_ACCEL_CONF;
+            seg.dir = BMI090L_XFER_READ;
+            seg.data = data;
+            seg.len = 2;
+            rslt = xfer_regs(&seg, 1, dev);
             if (rslt == BMI090L_OK)
             {
                 /* Update data with new odr and bw values */
@@ -1226,8 +2190,9 @@ int8_t bmi090la_set_meas_conf(struct bmi090l_dev *dev)
                 /* Update data with current range values */
                 data[1] = BMI090L_SET_BITS_POS_0(data[1], BMI090L_ACCEL_RANGE, range);
 
-                /* Write accel range to register */
-                rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_CONF, data, 2, dev);
+                /* Write accel config. and range registers */
+                seg.dir = BMI090L_XFER_WRITE;
+                rslt = xfer_regs(&seg, 1, dev);
 
                 if (rslt == BMI090L_OK)
                 {
@@ -1243,6 +2208,8 @@ int8_t bmi090la_set_meas_conf(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1255,6 +2222,8 @@ int8_t bmi090la_get_power_mode(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_POWER_MODE);
+
     rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_PWR_CONF, &data, 1, dev);
 
     if (rslt == BMI090L_OK)
@@ -1263,6 +2232,8 @@ int8_t bmi090la_get_power_mode(struct bmi090l_dev *dev)
         dev->accel_cfg.power = data;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1274,6 +2245,9 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t power_mode;
     uint8_t data[2] = { 0 };
+    uint8_t stale[6];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_POWER_MODE);
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
@@ -1284,21 +2258,7 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev)
         power_mode = dev->accel_cfg.power;
 
         /* Configure data array to write to accel power configuration register */
-        if (power_mode == BMI090L_ACCEL_PM_ACTIVE)
-        {
-            data[0] = BMI090L_ACCEL_PM_ACTIVE;
-            data[1] = BMI090L_ACCEL_POWER_ENABLE;
-        }
-        else if (power_mode == BMI090L_ACCEL_PM_SUSPEND)
-        {
-            data[0] = BMI090L_ACCEL_PM_SUSPEND;
-            data[1] = BMI090L_ACCEL_POWER_DISABLE;
-        }
-        else
-        {
-            /* Invalid power input */
-            rslt = BMI090L_E_INVALID_INPUT;
-        }
+        rslt = get_power_regs(power_mode, data);
 
         if (rslt == BMI090L_OK)
         {
@@ -1310,12 +2270,29 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev)
                 /* Delay between power ctrl and power config */
                 dev->delay_us(BMI090L_POWER_CONFIG_DELAY * 1000, dev->intf_ptr_accel);
 
+                if ((dev->wait_mode == BMI090L_WAIT_POLL) && (power_mode == BMI090L_ACCEL_PM_ACTIVE))
+                {
+                    /* Clear a stale data ready flag by reading the data registers */
+                    rslt = get_regs(BMI090L_REG_ACCEL_X_LSB, stale, sizeof(stale), dev);
+                }
+            }
+
+            if (rslt == BMI090L_OK)
+            {
                 /* Write to accel power configuration register */
                 rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_PWR_CTRL, &data[1], 1, dev);
 
-                if (rslt == BMI090L_OK)
+                if ((rslt == BMI090L_OK) && (power_mode == BMI090L_ACCEL_PM_ACTIVE))
+                {
+                    /* Wait for the first sample, at most the power mode switch delay */
+                    wait_ready(BMI090L_REG_ACCEL_STATUS,
+                               BMI090L_ACCEL_STATUS_MASK,
+                               BMI090L_ACCEL_STATUS_MASK,
+                               BMI090L_POWER_CONFIG_DELAY * 1000,
+                               dev);
+                }
+                else if (rslt == BMI090L_OK)
                 {
-
                     /* Delay required to switch power modes */
                     dev->delay_us(BMI090L_POWER_CONFIG_DELAY * 1000, dev->intf_ptr_accel);
                 }
@@ -1323,6 +2300,8 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1334,15 +2313,22 @@ int8_t bmi090la_set_power_mode(struct bmi090l_dev *dev)
 int8_t bmi090la_get_data(struct bmi090l_sensor_data *accel, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data[6];
+    uint8_t buff[6 + 1];
+    uint8_t *data;
     uint8_t lsb, msb;
     uint16_t msblsb;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_DATA);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
     /* Proceed if null check is fine */
-    if (accel != NULL)
+    if ((rslt == BMI090L_OK) && (accel != NULL))
     {
-        /* Read accel sensor data */
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_X_LSB, data, 6, dev);
+        /* Read accel sensor data, the dummy byte stays in front of the data */
+        rslt = get_regs_in_place(BMI090L_REG_ACCEL_X_LSB, buff, 6, dev);
+        data = &buff[get_dummy_len(dev)];
 
         if (rslt == BMI090L_OK)
         {
@@ -1362,7 +2348,245 @@ int8_t bmi090la_get_data(struct bmi090l_sensor_data *accel, struct bmi090l_dev *
             accel->z = ((int16_t) msblsb); /* Data in Z axis */
 
             /* Get the re-mapped accelerometer data */
-            get_remapped_data(accel, dev);
+            get_remapped_data(accel, 1, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the accel data and the sensor time in one burst.
+ */
+int8_t bmi090la_get_data_with_time(struct bmi090l_sensor_data *accel, uint32_t *sensor_time, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t buff[6 + BMI090L_SENSOR_TIME_LENGTH + 1];
+    uint8_t *data;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_DATA_WITH_TIME);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (accel != NULL) && (sensor_time != NULL))
+    {
+        /* Read accel sensor data and the following sensor time, the dummy byte stays in front of the data */
+        rslt = get_regs_in_place(BMI090L_REG_ACCEL_X_LSB, buff, 6 + BMI090L_SENSOR_TIME_LENGTH, dev);
+        data = &buff[get_dummy_len(dev)];
+
+        if (rslt == BMI090L_OK)
+        {
+            accel->x = (int16_t)((uint16_t)(data[1] << 8) | data[0]); /* Data in X axis */
+            accel->y = (int16_t)((uint16_t)(data[3] << 8) | data[2]); /* Data in Y axis */
+            accel->z = (int16_t)((uint16_t)(data[5] << 8) | data[4]); /* Data in Z axis */
+
+            /* Get the re-mapped accelerometer data */
+            get_remapped_data(accel, 1, dev);
+
+            /* Sensor time */
+            (*sensor_time) = ((uint32_t)data[6 + BMI090L_SENSOR_TIME_MSB_BYTE] << 16) |
+                             ((uint32_t)data[6 + BMI090L_SENSOR_TIME_XLSB_BYTE] << 8) |
+                             data[6 + BMI090L_SENSOR_TIME_LSB_BYTE];
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API polls the accel data ready status and appends the
+ *  samples to a ring in structure-of-arrays layout.
+ */
+int8_t bmi090la_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+                             struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t buff[6 + 1];
+    uint8_t *data;
+    uint8_t status = 0;
+    uint16_t read = 0;
+    uint32_t waited = 0;
+    uint32_t time_us = 0;
+    struct bmi090l_sensor_data sample;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_POLL_SAMPLES);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (ring != NULL) && (n_read != NULL) && (ring->x != NULL) && (ring->y != NULL) &&
+        (ring->z != NULL) && ((ring->time_us == NULL) || (dev->timestamp_us != NULL)))
+    {
+        /* A ring state out of range would make the writes go past the arrays */
+        if ((ring->size == 0) || (ring->head >= ring->size) || (ring->count > ring->size))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+
+        while ((rslt == BMI090L_OK) && (read < count))
+        {
+            rslt = get_regs(BMI090L_REG_ACCEL_STATUS, &status, 1, dev);
+
+            if ((rslt == BMI090L_OK) && ((status & BMI090L_ACCEL_STATUS_MASK) != 0))
+            {
+                /* Timestamp when data ready was seen */
+                if (ring->time_us != NULL)
+                {
+                    time_us = dev->timestamp_us(dev->intf_ptr_accel);
+                }
+
+                /* The dummy byte stays in front of the data */
+                rslt = get_regs_in_place(BMI090L_REG_ACCEL_X_LSB, buff, 6, dev);
+                data = &buff[get_dummy_len(dev)];
+
+                if (rslt == BMI090L_OK)
+                {
+                    sample.x = (int16_t)((uint16_t)(data[1] << 8) | data[0]); /* Data in X axis */
+                    sample.y = (int16_t)((uint16_t)(data[3] << 8) | data[2]); /* Data in Y axis */
+                    sample.z = (int16_t)((uint16_t)(data[5] << 8) | data[4]); /* Data in Z axis */
+
+                    /* Get the re-mapped accelerometer data */
+                    get_remapped_data(&sample, 1, dev);
+
+                    sample_ring_put(ring, &sample, time_us);
+                    read++;
+                    waited = 0;
+                }
+            }
+            else if (rslt == BMI090L_OK)
+            {
+                if (waited >= BMI090L_SAMPLE_TIMEOUT_US)
+                {
+                    /* No new sample, hand out what was read so far */
+                    rslt = BMI090L_W_PARTIAL_READ;
+                }
+                else
+                {
+                    dev->delay_us(BMI090L_SAMPLE_POLL_US, dev->intf_ptr_accel);
+                    waited += BMI090L_SAMPLE_POLL_US;
+                }
+            }
+        }
+
+        (*n_read) = read;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API converts a batch of raw accel samples to float.
+ */
+int8_t bmi090la_convert_data(const struct bmi090l_sensor_data *raw,
+                             struct bmi090l_sensor_data_f *data,
+                             uint16_t count,
+                             uint8_t unit,
+                             struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint16_t indx;
+    float scale;
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (raw != NULL) && (data != NULL))
+    {
+        if ((unit != BMI090L_UNIT_G) && (unit != BMI090L_UNIT_MPS2))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+        else if (dev->accel_cfg.range > BMI090L_ACCEL_RANGE_24G)
+        {
+            rslt = BMI090L_E_INVALID_CONFIG;
+        }
+        else
+        {
+            /* Scale per LSB, the full scale doubles with every range step */
+            scale = (float)(BMI090L_ACCEL_FULL_SCALE_G << dev->accel_cfg.range) / (float)BMI090L_HALF_SCALE;
+            if (unit == BMI090L_UNIT_MPS2)
+            {
+                scale *= BMI090L_GRAVITY_EARTH;
+            }
+
+            /* One multiply per value and no branch, the loop is left to the compiler to vectorize */
+            for (indx = 0; indx < count; indx++)
+            {
+                data[indx].x = (float)raw[indx].x * scale;
+                data[indx].y = (float)raw[indx].y * scale;
+                data[indx].z = (float)raw[indx].z * scale;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API converts a batch of raw accel samples to Q16.16 fixed point.
+ */
+int8_t bmi090la_convert_data_q16(const struct bmi090l_sensor_data *raw,
+                                 struct bmi090l_sensor_data_q16 *data,
+                                 uint16_t count,
+                                 uint8_t unit,
+                                 struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint16_t indx;
+    int32_t scale;
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (raw != NULL) && (data != NULL))
+    {
+        if ((unit != BMI090L_UNIT_G) && (unit != BMI090L_UNIT_MPS2))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+        else if (dev->accel_cfg.range > BMI090L_ACCEL_RANGE_24G)
+        {
+            rslt = BMI090L_E_INVALID_CONFIG;
+        }
+        else
+        {
+            /* Full scale of the configured range in Q16.16 */
+            scale = (unit == BMI090L_UNIT_G) ? (BMI090L_ACCEL_FULL_SCALE_G << 16) : BMI090L_ACCEL_FULL_SCALE_MPS2_Q16;
+            scale = scale << dev->accel_cfg.range;
+
+            for (indx = 0; indx < count; indx++)
+            {
+                data[indx].x = (int32_t)(((int64_t)raw[indx].x * scale) / BMI090L_HALF_SCALE);
+                data[indx].y = (int32_t)(((int64_t)raw[indx].y * scale) / BMI090L_HALF_SCALE);
+                data[indx].z = (int32_t)(((int64_t)raw[indx].z * scale) / BMI090L_HALF_SCALE);
+            }
         }
     }
     else
@@ -1382,6 +2606,8 @@ int8_t bmi090la_set_int_config(const struct bmi090l_accel_int_channel_cfg *int_c
 {
     int8_t rslt;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_INT_CONFIG);
+
     /* Proceed if null check is fine */
     if (int_config != NULL)
     {
@@ -1457,6 +2683,8 @@ int8_t bmi090la_set_int_config(const struct bmi090l_accel_int_channel_cfg *int_c
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1471,6 +2699,8 @@ int8_t bmi090la_get_sensor_temperature(struct bmi090l_dev *dev, int32_t *sensor_
     uint16_t msblsb;
     int16_t temp;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_SENSOR_TEMPERATURE);
+
     /* Proceed if null check is fine */
     if (sensor_temp != NULL)
     {
@@ -1502,6 +2732,8 @@ int8_t bmi090la_get_sensor_temperature(struct bmi090l_dev *dev, int32_t *sensor_
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1514,6 +2746,8 @@ int8_t bmi090la_get_sensor_time(struct bmi090l_dev *dev, uint32_t *sensor_time)
     uint8_t data[3] = { 0 };
     uint32_t byte2, byte1, byte0;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_SENSOR_TIME);
+
     /* Proceed if null check is fine */
     if (sensor_time != NULL)
     {
@@ -1535,6 +2769,8 @@ int8_t bmi090la_get_sensor_time(struct bmi090l_dev *dev, uint32_t *sensor_time)
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1548,6 +2784,8 @@ int8_t bmi090la_perform_selftest(struct bmi090l_dev *dev)
     int8_t self_test_rslt = 0;
     struct bmi090l_sensor_data accel_pos, accel_neg;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_PERFORM_SELFTEST);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -1587,6 +2825,8 @@ int8_t bmi090la_perform_selftest(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1603,6 +2843,8 @@ int8_t bmi090la_set_fifo_config(const struct bmi090l_accel_fifo_config *config,
      */
     uint8_t data_array[2] = { 0 };
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_FIFO_CONFIG);
+
     if (config != NULL)
     {
         /* Get the FIFO configurations from the FIFO configure_1 and configure_2 register */
@@ -1622,6 +2864,10 @@ int8_t bmi090la_set_fifo_config(const struct bmi090l_accel_fifo_config *config,
             data_array[1] = BMI090L_SET_BITS(data_array[1], BMI090L_ACCEL_INT2_EN, config->int2_en);
 
             rslt = bmi090la_set_regs(BMI090L_FIFO_CONFIG_0_ADDR, data_array, 2, dev);
+            if (rslt == BMI090L_OK)
+            {
+                dev->accel_fifo_en = data_array[1] & BMI090L_ACCEL_EN_MASK;
+            }
         }
     }
     else
@@ -1629,6 +2875,8 @@ int8_t bmi090la_set_fifo_config(const struct bmi090l_accel_fifo_config *config,
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1643,6 +2891,8 @@ int8_t bmi090la_get_fifo_config(struct bmi090l_accel_fifo_config *config, struct
     /* Array to store data */
     uint8_t data[2] = { 0 };
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_FIFO_CONFIG);
+
     if (config != NULL)
     {
         /* Get the FIFO configuration value */
@@ -1660,6 +2910,8 @@ int8_t bmi090la_get_fifo_config(struct bmi090l_accel_fifo_config *config, struct
 
             /* Get the interrupt_2 enable/disable */
             config->int2_en = BMI090L_GET_BITS(data[1], BMI090L_ACCEL_INT2_EN);
+
+            dev->accel_fifo_en = data[1] & BMI090L_ACCEL_EN_MASK;
         }
     }
     else
@@ -1667,6 +2919,8 @@ int8_t bmi090la_get_fifo_config(struct bmi090l_accel_fifo_config *config, struct
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1684,88 +2938,321 @@ int8_t bmi090la_read_fifo_data(struct bmi090l_fifo_frame *fifo, struct bmi090l_d
     /* Variable to define FIFO address */
     uint8_t addr = BMI090L_FIFO_DATA_ADDR;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_READ_FIFO_DATA);
+
     if (fifo != NULL)
     {
         /* Clear the FIFO data structure */
         reset_fifo_frame_structure(fifo);
 
-        /* Read FIFO data */
-        rslt = bmi090la_get_regs(addr, fifo->data, fifo->length, dev);
-        if (rslt == BMI090L_OK)
+        rslt = null_ptr_check(dev);
+        if ((rslt == BMI090L_OK) && (fifo->data == NULL))
         {
-            /* Get the set FIFO frame configurations */
-            rslt = bmi090la_get_regs(BMI090L_FIFO_CONFIG_1_ADDR, &config_data, 1, dev);
-            if (rslt == BMI090L_OK)
+            rslt = BMI090L_E_NULL_PTR;
+        }
+
+        if ((rslt == BMI090L_OK) && (dev->dummy_byte_mode == BMI090L_DUMMY_BYTE_HEADROOM) &&
+            (get_dummy_len(dev) != 0))
+        {
+            if (fifo->length > get_dummy_len(dev))
+            {
+                /* Read FIFO data in place, parsing starts after the dummy byte */
+                rslt = get_regs_in_place(addr, fifo->data, fifo->length - get_dummy_len(dev), dev);
+                fifo->acc_byte_start_idx = get_dummy_len(dev);
+            }
+            else
             {
-                /* Get sensor enable status, of which the data is to be read */
-                fifo->acc_data_enable = (uint16_t)((uint16_t)config_data & BMI090L_ACCEL_EN_MASK);
+                rslt = BMI090L_E_RD_WR_LENGTH_INVALID;
             }
         }
+        else if (rslt == BMI090L_OK)
+        {
+            /* Read FIFO data */
+            rslt = bmi090la_get_regs(addr, fifo->data, fifo->length, dev);
+        }
+
+        if (rslt == BMI090L_OK)
+        {
+            /* Get sensor enable status, of which the data is to be read */
+            rslt = get_fifo_accel_en(&config_data, dev);
+            fifo->acc_data_enable = config_data;
+        }
     }
     else
     {
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- * @brief This API gets the length of FIFO data available in the sensor in
- * bytes.
+ * @brief This API starts a non-blocking read of the FIFO data.
  */
-int8_t bmi090la_get_fifo_length(uint16_t *fifo_length, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t accel_en = 0;
+    uint8_t reg_addr = BMI090L_FIFO_DATA_ADDR;
 
-    /* Array to store FIFO data length */
-    uint8_t data[BMI090L_FIFO_DATA_LENGTH] = { 0 };
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_FIFO_READ_START);
 
-    if (fifo_length != NULL)
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && ((xfer == NULL) || (xfer->fifo == NULL) || (xfer->fifo->data == NULL) ||
+                                 (dev->read_async == NULL)))
     {
-        /* Read fifo length */
-        rslt = bmi090la_get_regs(BMI090L_FIFO_LENGTH_0_ADDR, data, BMI090L_FIFO_DATA_LENGTH, dev);
-        if (rslt == BMI090L_OK)
-        {
-            /* Get the MSB byte of FIFO length */
-            data[1] = BMI090L_GET_BITS_POS_0(data[1], BMI090L_FIFO_BYTE_COUNTER_MSB);
+        rslt = BMI090L_E_NULL_PTR;
+    }
+    else if ((rslt == BMI090L_OK) && (xfer->busy))
+    {
+        rslt = BMI090L_E_BUSY;
+    }
+    else if ((rslt == BMI090L_OK) && (xfer->fifo->length <= get_dummy_len(dev)))
+    {
+        rslt = BMI090L_E_RD_WR_LENGTH_INVALID;
+    }
 
-            /* Get total FIFO length */
-            (*fifo_length) = (uint16_t)((uint16_t)(data[1] << 8) | data[0]);
-        }
+    if (rslt == BMI090L_OK)
+    {
+        /* Enable bit is read at most once, before the transfer */
+        rslt = get_fifo_accel_en(&accel_en, dev);
     }
-    else
+
+    if (rslt == BMI090L_OK)
     {
-        rslt = BMI090L_E_NULL_PTR;
+        /* Clear the FIFO data structure, parsing starts after the dummy byte */
+        reset_fifo_frame_structure(xfer->fifo);
+        xfer->fifo->acc_data_enable = accel_en;
+        xfer->fifo->acc_byte_start_idx = get_dummy_len(dev);
+        xfer->dev = dev;
+        xfer->busy = TRUE;
+
+        if (dev->intf == BMI090L_SPI_INTF)
+        {
+            /* Configuring reg_addr for SPI Interface */
+            reg_addr = reg_addr | BMI090L_SPI_RD_MASK;
+        }
+
+        /* Completion may already be reported from inside the call */
+        BMI090L_STATS_BUS(dev, BMI090L_XFER_READ, xfer->fifo->length);
+        dev->intf_rslt = dev->read_async(reg_addr, xfer->fifo->data, xfer->fifo->length, dev->intf_ptr_accel, xfer);
+
+        if (dev->intf_rslt != BMI090L_INTF_RET_SUCCESS)
+        {
+            xfer->busy = FALSE;
+            rslt = BMI090L_E_COM_FAIL;
+        }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in the sensor.
+ * @brief This API finishes a non-blocking read of the FIFO data.
  */
-int8_t bmi090la_get_fifo_wm(uint16_t *wm, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt)
 {
-    int8_t rslt;
-    uint8_t data[2] = { 0 };
+    int8_t rslt = BMI090L_OK;
 
-    rslt = bmi090la_get_regs(BMI090L_FIFO_WTM_0_ADDR, data, BMI090L_FIFO_WTM_LENGTH, dev);
-    if ((rslt == BMI090L_OK) && (wm != NULL))
+    if ((xfer == NULL) || (xfer->dev == NULL))
     {
-        *wm = (data[1] << 8) | (data[0]);
+        rslt = BMI090L_E_NULL_PTR;
     }
     else
     {
-        rslt = BMI090L_E_NULL_PTR;
+        if (intf_rslt != BMI090L_INTF_RET_SUCCESS)
+        {
+            rslt = BMI090L_E_COM_FAIL;
+        }
+
+        xfer->dev->intf_rslt = intf_rslt;
+        xfer->rslt = rslt;
+        xfer->busy = FALSE;
+
+        if (xfer->done != NULL)
+        {
+            xfer->done(xfer, rslt);
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO water-mark level in the sensor.
+ * @brief This API gets the length of FIFO data available in the sensor in
+ * bytes.
+ */
+int8_t bmi090la_get_fifo_length(uint16_t *fifo_length, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to store FIFO data length */
+    uint8_t data[BMI090L_FIFO_DATA_LENGTH] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_FIFO_LENGTH);
+
+    if (fifo_length != NULL)
+    {
+        /* Read fifo length */
+        rslt = bmi090la_get_regs(BMI090L_FIFO_LENGTH_0_ADDR, data, BMI090L_FIFO_DATA_LENGTH, dev);
+        if (rslt == BMI090L_OK)
+        {
+            /* Get the MSB byte of FIFO length */
+            data[1] = BMI090L_GET_BITS_POS_0(data[1], BMI090L_FIFO_BYTE_COUNTER_MSB);
+
+            /* Get total FIFO length */
+            (*fifo_length) = (uint16_t)((uint16_t)(data[1] << 8) | data[0]);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API drains the accel FIFO, with or without a length query.
+ */
+int8_t bmi090la_drain_fifo(struct bmi090l_fifo_frame *fifo,
+                           uint8_t mode,
+                           uint16_t *fifo_length,
+                           struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t accel_en = 0;
+    uint8_t start = 0;
+    uint16_t size;
+    uint16_t length = 0;
+    uint32_t read_len;
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_DRAIN_FIFO);
+
+    if ((rslt == BMI090L_OK) && (fifo != NULL) && (fifo->data != NULL) && (fifo_length != NULL))
+    {
+        size = fifo->length;
+
+        if (dev->dummy_byte_mode == BMI090L_DUMMY_BYTE_HEADROOM)
+        {
+            /* The dummy byte is kept at the start of the buffer */
+            start = get_dummy_len(dev);
+        }
+
+        if (mode == BMI090L_FIFO_DRAIN_EXACT)
+        {
+            rslt = bmi090la_get_fifo_length(&length, dev);
+
+            if (rslt == BMI090L_OK)
+            {
+                /* FIFO content and the sensor time frame behind it */
+                read_len = (uint32_t)start + length + BMI090L_SENSOR_TIME_LENGTH + 1;
+                if (read_len < size)
+                {
+                    fifo->length = (uint16_t)read_len;
+                }
+
+                rslt = bmi090la_read_fifo_data(fifo, dev);
+
+                if ((rslt == BMI090L_OK) && (read_len > size))
+                {
+                    rslt = BMI090L_W_PARTIAL_READ;
+                }
+            }
+        }
+        else if (mode == BMI090L_FIFO_DRAIN_OVER_READ)
+        {
+            if (size <= (start + BMI090L_FIFO_DATA_LENGTH))
+            {
+                rslt = BMI090L_E_RD_WR_LENGTH_INVALID;
+            }
+            else
+            {
+                reset_fifo_frame_structure(fifo);
+
+                /* The burst continues from FIFO_LENGTH_1 into FIFO_DATA */
+                if (start != 0)
+                {
+                    rslt = get_regs_in_place(BMI090L_FIFO_LENGTH_0_ADDR, fifo->data, size - start, dev);
+                }
+                else
+                {
+                    rslt = get_regs(BMI090L_FIFO_LENGTH_0_ADDR, fifo->data, size, dev);
+                }
+            }
+
+            if (rslt == BMI090L_OK)
+            {
+                length = (uint16_t)((uint16_t)(BMI090L_GET_BITS_POS_0(fifo->data[start + 1],
+                                                                      BMI090L_FIFO_BYTE_COUNTER_MSB) << 8) |
+                                    fifo->data[start]);
+                fifo->acc_byte_start_idx = start + BMI090L_FIFO_DATA_LENGTH;
+
+                rslt = get_fifo_accel_en(&accel_en, dev);
+                fifo->acc_data_enable = accel_en;
+
+                if ((rslt == BMI090L_OK) && (length > (size - fifo->acc_byte_start_idx)))
+                {
+                    rslt = BMI090L_W_PARTIAL_READ;
+                }
+            }
+        }
+        else
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+
+        (*fifo_length) = length;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level in the sensor.
+ */
+int8_t bmi090la_get_fifo_wm(uint16_t *wm, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data[2] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_FIFO_WM);
+
+    rslt = bmi090la_get_regs(BMI090L_FIFO_WTM_0_ADDR, data, BMI090L_FIFO_WTM_LENGTH, dev);
+    if ((rslt == BMI090L_OK) && (wm != NULL))
+    {
+        *wm = (data[1] << 8) | (data[0]);
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO water-mark level in the sensor.
  */
 int8_t bmi090la_set_fifo_wm(uint16_t wm, struct bmi090l_dev *dev)
 {
@@ -1775,6 +3262,8 @@ int8_t bmi090la_set_fifo_wm(uint16_t wm, struct bmi090l_dev *dev)
     /* Array to store data */
     uint8_t data[2] = { 0 };
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_FIFO_WM);
+
     /* Get LSB value of FIFO water-mark */
     data[0] = BMI090L_GET_LSB(wm);
 
@@ -1784,6 +3273,8 @@ int8_t bmi090la_set_fifo_wm(uint16_t wm, struct bmi090l_dev *dev)
     /* Set the FIFO water-mark level */
     rslt = bmi090la_set_regs(BMI090L_FIFO_WTM_0_ADDR, data, BMI090L_FIFO_WTM_LENGTH, dev);
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -1806,6 +3297,9 @@ int8_t bmi090la_extract_accel(struct bmi090l_sensor_data *accel_data,
     {
         /* Parsing the FIFO data in header mode */
         rslt = extract_acc_header_mode(accel_data, accel_length, fifo);
+
+        /* Re-map the extracted batch */
+        get_remapped_data(accel_data, *accel_length, dev);
     }
     else
     {
@@ -1816,25 +3310,17 @@ int8_t bmi090la_extract_accel(struct bmi090l_sensor_data *accel_data,
 }
 
 /*!
- * @brief This API reads the down sampling rates which is configured for
- * accelerometer FIFO data.
+ * @brief This API resets the streaming FIFO parser.
  */
-int8_t bmi090la_get_fifo_down_sample(uint8_t *fifo_downs, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_parser_init(struct bmi090l_fifo_parser *parser)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Variable to store sampling rate */
-    uint8_t data = 0;
+    int8_t rslt = BMI090L_OK;
 
-    if (fifo_downs != NULL)
+    if (parser != NULL)
     {
-        /* Read the accelerometer FIFO down data sampling rate */
-        rslt = bmi090la_get_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
-        if (rslt == BMI090L_OK)
-        {
-            (*fifo_downs) = BMI090L_GET_BITS(data, BMI090L_ACC_FIFO_DOWNS);
-        }
+        parser->skipped_frame_count = 0;
+        parser->sensor_time = 0;
+        parser->partial_len = 0;
     }
     else
     {
@@ -1845,169 +3331,187 @@ int8_t bmi090la_get_fifo_down_sample(uint8_t *fifo_downs, struct bmi090l_dev *de
 }
 
 /*!
- * @brief This API sets the down-sampling rates for accelerometer
- * FIFO data.
- *
- * @note Reduction of sample rate by a factor 2**fifo_downs
+ * @brief This API drops the cut off frame held by the streaming FIFO parser
+ * before the data of a new FIFO_DATA read.
  */
-int8_t bmi090la_set_fifo_down_sample(uint8_t fifo_downs, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_parser_new_read(struct bmi090l_fifo_parser *parser)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Variable to store sampling rate */
-    uint8_t data = 0;
+    int8_t rslt = BMI090L_OK;
 
-    /* Set the accelerometer FIFO down sampling rate */
-    rslt = bmi090la_get_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
-    if (rslt == BMI090L_OK)
+    if (parser != NULL)
     {
-        data = BMI090L_SET_BITS(data, BMI090L_ACC_FIFO_DOWNS, fifo_downs);
-        rslt = bmi090la_set_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
+        parser->partial_len = 0;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- *  @brief This API is used to enable/disable and configure the data synchronization
- *  feature.
+ * @brief This API parses a chunk of header mode FIFO data. A frame cut off at
+ * the end of the chunk is held and completed by the next chunk.
  */
-int8_t bmi090la_configure_data_synchronization(struct bmi090l_data_sync_cfg sync_cfg, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_parse(struct bmi090l_fifo_parser *parser,
+                           const uint8_t *data,
+                           uint16_t *data_length,
+                           struct bmi090l_sensor_data *accel_data,
+                           uint16_t *accel_length,
+                           const struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint16_t data[BMI090L_ACCEL_DATA_SYNC_LEN];
+    uint16_t data_indx = 0;
+    uint16_t accel_indx = 0;
+    uint16_t copy;
+    uint8_t frame_len;
+    const uint8_t *frame;
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
-
-    /* Proceed if null check is fine */
-    if (rslt == BMI090L_OK)
+    if ((rslt == BMI090L_OK) && (parser != NULL) && (data != NULL) && (data_length != NULL) &&
+        (accel_data != NULL) && (accel_length != NULL) && (parser->partial_len < BMI090L_FIFO_MAX_FRAME_LENGTH))
     {
-        /* Change sensor meas config */
-        switch (sync_cfg.mode)
+        while ((rslt == BMI090L_OK) && (data_indx < (*data_length)) && (accel_indx < (*accel_length)))
         {
-            case BMI090L_ACCEL_DATA_SYNC_MODE_2000HZ:
-                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_1600_HZ;
-                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
-                dev->gyro_cfg.odr = BMI090L_GYRO_BW_230_ODR_2000_HZ;
-                dev->gyro_cfg.bw = BMI090L_GYRO_BW_230_ODR_2000_HZ;
-                break;
-            case BMI090L_ACCEL_DATA_SYNC_MODE_1000HZ:
-                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_800_HZ;
-                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
-                dev->gyro_cfg.odr = BMI090L_GYRO_BW_116_ODR_1000_HZ;
-                dev->gyro_cfg.bw = BMI090L_GYRO_BW_116_ODR_1000_HZ;
-                break;
-            case BMI090L_ACCEL_DATA_SYNC_MODE_400HZ:
-                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_400_HZ;
-                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
-                dev->gyro_cfg.odr = BMI090L_GYRO_BW_47_ODR_400_HZ;
-                dev->gyro_cfg.bw = BMI090L_GYRO_BW_47_ODR_400_HZ;
-                break;
-            default:
-                break;
-        }
+            frame = NULL;
 
-        rslt = bmi090la_set_meas_conf(dev);
-        if (rslt != BMI090L_OK)
-        {
-            return rslt;
+            if (parser->partial_len > 0)
+            {
+                /* Complete the frame held from the previous chunk */
+                frame_len = get_fifo_frame_len(parser->partial[0]);
+                copy = (uint16_t)(frame_len - parser->partial_len);
+                if (copy > ((*data_length) - data_indx))
+                {
+                    copy = (*data_length) - data_indx;
+                }
+
+                for (; copy > 0; copy--)
+                {
+                    parser->partial[parser->partial_len++] = data[data_indx++];
+                }
+
+                if (parser->partial_len == frame_len)
+                {
+                    frame = parser->partial;
+                    parser->partial_len = 0;
+                }
+            }
+            else
+            {
+                frame_len = get_fifo_frame_len(data[data_indx]);
+
+                if (frame_len == 0)
+                {
+                    /* Over-read or invalid header, no frames follow in this chunk */
+                    data_indx = (*data_length);
+                    rslt = BMI090L_W_FIFO_EMPTY;
+                }
+                else if ((data_indx + frame_len) <= (*data_length))
+                {
+                    frame = &data[data_indx];
+                    data_indx += frame_len;
+                }
+                else
+                {
+                    /* Keep the cut off frame for the next chunk */
+                    while (data_indx < (*data_length))
+                    {
+                        parser->partial[parser->partial_len++] = data[data_indx++];
+                    }
+                }
+            }
+
+            if (frame != NULL)
+            {
+                parse_fifo_frame(parser, frame, accel_data, &accel_indx);
+            }
         }
 
-        rslt = bmi090lg_set_meas_conf(dev);
-        if (rslt != BMI090L_OK)
+        if ((rslt == BMI090L_OK) && (data_indx < (*data_length)))
         {
-            return rslt;
+            /* No room left for the remaining frames */
+            rslt = BMI090L_W_PARTIAL_READ;
         }
 
-        /* Enable data synchronization */
-        data[0] = (sync_cfg.mode & BMI090L_ACCEL_DATA_SYNC_MODE_MASK);
-        rslt = bmi090la_write_feature_config(BMI090L_ACCEL_DATA_SYNC_ADR, &data[0], BMI090L_ACCEL_DATA_SYNC_LEN, dev);
+        /* Re-map the parsed batch */
+        get_remapped_data(accel_data, accel_indx, dev);
+
+        (*data_length) = data_indx;
+        (*accel_length) = accel_indx;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- *  @brief This API is used to enable/disable and configure the anymotion
- *  feature.
+ * @brief This API walks the accel FIFO data once and calls the visitor
+ * callback of each frame.
  */
-int8_t bmi090la_configure_anymotion(struct bmi090l_anymotion_cfg anymotion_cfg, struct bmi090l_dev *dev)
+int8_t bmi090la_visit_fifo(struct bmi090l_fifo_frame *fifo,
+                           const struct bmi090l_fifo_visitor *visitor,
+                           const struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint16_t data[BMI090L_ACCEL_ANYMOTION_LEN];
+    struct bmi090l_fifo_event event;
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
-
-    /* Proceed if null check is fine */
-    if (rslt == BMI090L_OK)
+    if ((rslt == BMI090L_OK) && (fifo != NULL) && (fifo->data != NULL) && (visitor != NULL))
     {
-        /* Enable data synchronization */
-        data[0] = (anymotion_cfg.threshold & BMI090L_ACCEL_ANYMOTION_THRESHOLD_MASK);
-        data[0] |=
-            ((anymotion_cfg.enable << BMI090L_ACCEL_ANYMOTION_NOMOTION_SEL_SHIFT) &
-             BMI090L_ACCEL_ANYMOTION_NOMOTION_SEL_MASK);
-        data[1] = (anymotion_cfg.duration & BMI090L_ACCEL_ANYMOTION_DURATION_MASK);
-        data[1] |= ((anymotion_cfg.x_en << BMI090L_ACCEL_ANYMOTION_X_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_X_EN_MASK);
-        data[1] |= ((anymotion_cfg.y_en << BMI090L_ACCEL_ANYMOTION_Y_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_Y_EN_MASK);
-        data[1] |= ((anymotion_cfg.z_en << BMI090L_ACCEL_ANYMOTION_Z_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_Z_EN_MASK);
-        rslt = bmi090la_write_feature_config(BMI090L_ACCEL_ANYMOTION_ADR, &data[0], BMI090L_ACCEL_ANYMOTION_LEN, dev);
-    }
+        while ((rslt == BMI090L_OK) && (fifo->acc_byte_start_idx < fifo->length))
+        {
+            rslt = get_fifo_event(&event, fifo, dev);
 
-    return rslt;
-}
+            if (rslt == BMI090L_OK)
+            {
+                switch (event.type)
+                {
+                    case BMI090L_FIFO_EVENT_ACCEL:
+                        if (visitor->accel != NULL)
+                        {
+                            visitor->accel(&event.accel, visitor->ctx);
+                        }
 
-/*!
- *  @brief This API reads the synchronized accel & gyro data from the sensor,
- *  store it in the bmi090l_sensor_data structure instance
- *  passed by the user.
- */
-int8_t bmi090la_get_synchronized_data(struct bmi090l_sensor_data *accel,
-                                      struct bmi090l_sensor_data *gyro,
-                                      struct bmi090l_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg_addr, data[6];
-    uint8_t lsb, msb;
-    uint16_t msblsb;
+                        break;
 
-    /* Check for null pointer in the device structure */
-    rslt = null_ptr_check(dev);
+                    case BMI090L_FIFO_EVENT_SENSOR_TIME:
+                        if (visitor->sensor_time != NULL)
+                        {
+                            visitor->sensor_time(event.sensor_time, visitor->ctx);
+                        }
 
-    /* Proceed if null check is fine */
-    if ((rslt == BMI090L_OK) && (accel != NULL) && (gyro != NULL))
-    {
-        /* Read accel x,y sensor data */
-        reg_addr = BMI090L_REG_ACCEL_GP_0;
-        rslt = bmi090la_get_regs(reg_addr, &data[0], 4, dev);
+                        break;
 
-        if (rslt == BMI090L_OK)
-        {
-            /* Read accel sensor data */
-            reg_addr = BMI090L_REG_ACCEL_GP_4;
-            rslt = bmi090la_get_regs(reg_addr, &data[4], 2, dev);
+                    case BMI090L_FIFO_EVENT_SKIP:
+                        if (visitor->skip != NULL)
+                        {
+                            visitor->skip(event.value, visitor->ctx);
+                        }
 
-            if (rslt == BMI090L_OK)
-            {
-                lsb = data[0];
-                msb = data[1];
-                msblsb = (msb << 8) | lsb;
-                accel->x = ((int16_t) msblsb); /* Data in X axis */
+                        break;
 
-                lsb = data[2];
-                msb = data[3];
-                msblsb = (msb << 8) | lsb;
-                accel->y = ((int16_t) msblsb); /* Data in Y axis */
+                    case BMI090L_FIFO_EVENT_INPUT_CFG:
+                        if (visitor->input_cfg != NULL)
+                        {
+                            visitor->input_cfg(event.value, visitor->ctx);
+                        }
 
-                lsb = data[4];
-                msb = data[5];
-                msblsb = (msb << 8) | lsb;
-                accel->z = ((int16_t) msblsb); /* Data in Z axis */
+                        break;
 
-                /* Read gyro sensor data */
-                rslt = bmi090lg_get_data(gyro, dev);
+                    default:
+                        if (visitor->sample_drop != NULL)
+                        {
+                            visitor->sample_drop(event.value, visitor->ctx);
+                        }
+
+                        break;
+                }
             }
         }
     }
@@ -2020,31 +3524,38 @@ int8_t bmi090la_get_synchronized_data(struct bmi090l_sensor_data *accel,
 }
 
 /*!
- *  @brief This API configures the synchronization interrupt
- *  based on the user settings in the bmi090l_int_cfg
- *  structure instance.
+ * @brief This API walks the accel FIFO data once and stores one event per
+ * frame.
  */
-int8_t bmi090la_set_data_sync_int_config(const struct bmi090l_int_cfg *int_config, struct bmi090l_dev *dev)
+int8_t bmi090la_get_fifo_events(struct bmi090l_fifo_event *events,
+                                uint16_t *event_count,
+                                struct bmi090l_fifo_frame *fifo,
+                                const struct bmi090l_dev *dev)
 {
     int8_t rslt;
+    uint16_t event_indx = 0;
 
-    if (int_config != NULL)
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI090L_OK) && (events != NULL) && (event_count != NULL) && (fifo != NULL) && (fifo->data != NULL))
     {
-        /* Configure accel sync data ready interrupt configuration */
-        rslt = bmi090la_set_int_config(&int_config->accel_int_config_1, dev);
-        if (rslt == BMI090L_OK)
+        while ((rslt == BMI090L_OK) && (fifo->acc_byte_start_idx < fifo->length) && (event_indx < (*event_count)))
         {
-            rslt = bmi090la_set_int_config(&int_config->accel_int_config_2, dev);
+            rslt = get_fifo_event(&events[event_indx], fifo, dev);
+
             if (rslt == BMI090L_OK)
             {
-                /* Configure gyro data ready interrupt configuration */
-                rslt = bmi090lg_set_int_config(&int_config->gyro_int_config_1, dev);
-                if (rslt == BMI090L_OK)
-                {
-                    rslt = bmi090lg_set_int_config(&int_config->gyro_int_config_2, dev);
-                }
+                event_indx++;
             }
         }
+
+        if ((rslt == BMI090L_OK) && (fifo->acc_byte_start_idx < fifo->length))
+        {
+            /* No room left for the remaining frames */
+            rslt = BMI090L_W_PARTIAL_READ;
+        }
+
+        (*event_count) = event_indx;
     }
     else
     {
@@ -2055,689 +3566,2583 @@ int8_t bmi090la_set_data_sync_int_config(const struct bmi090l_int_cfg *int_confi
 }
 
 /*!
- * @brief This internal API gets accel feature interrupt status
+ * @brief This API extracts the accel samples from the FIFO data and
+ * reconstructs the time of each sample.
  */
-int8_t bmi090la_get_data_int_status(uint8_t *int_status, struct bmi090l_dev *dev)
+int8_t bmi090la_extract_accel_time(struct bmi090l_sensor_data *accel_data,
+                                   uint64_t *sample_time,
+                                   uint16_t *accel_length,
+                                   struct bmi090l_fifo_frame *fifo,
+                                   struct bmi090l_fifo_timeline *timeline,
+                                   struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t status = 0;
+    struct bmi090l_fifo_event event;
+    uint16_t accel_indx = 0;
+    uint16_t resume_idx = 0;
+    uint16_t indx;
+    uint8_t data[4] = { 0 };
+    uint8_t fifo_mode;
+    uint8_t fifo_downs;
+    uint8_t anchored = FALSE;
+    uint8_t full = FALSE;
+    uint64_t skipped = 0;
+    uint64_t prev_skipped = 0;
+    uint64_t sensor_time = 0;
+    uint64_t period = 0;
+    uint64_t time;
 
-    if (int_status != NULL)
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_EXTRACT_ACCEL_TIME);
+
+    if ((rslt == BMI090L_OK) && (accel_data != NULL) && (sample_time != NULL) && (accel_length != NULL) &&
+        (fifo != NULL) && (fifo->data != NULL) && (timeline != NULL))
     {
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT_STAT_1, &status, 1, dev);
-        if (rslt == BMI090L_OK)
+        /* FIFO_DOWNS to FIFO_CONFIG_0 from the shadow cache, else as given in the timeline */
+        if (shadow_get(BMI090L_FIFO_DOWNS_ADDR, data, 4, dev))
         {
-            (*int_status) = status;
+            fifo_downs = BMI090L_GET_BITS(data[0], BMI090L_ACC_FIFO_DOWNS);
+            fifo_mode = BMI090L_GET_BITS_POS_0(data[3], BMI090L_ACC_FIFO_MODE_CONFIG);
+        }
+        else
+        {
+            fifo_downs = timeline->fifo_downs;
+            fifo_mode = timeline->fifo_mode;
+        }
+
+        if ((dev->accel_cfg.odr < BMI090L_ACCEL_ODR_12_5_HZ) || (dev->accel_cfg.odr > BMI090L_ACCEL_ODR_1600_HZ) ||
+            (fifo_downs > (BMI090L_ACC_FIFO_DOWNS_MASK >> BMI090L_ACC_FIFO_DOWNS_POS)) ||
+            (fifo_mode > BMI090L_ACC_FIFO_MODE))
+        {
+            rslt = BMI090L_E_INVALID_CONFIG;
+        }
+        else
+        {
+            /* Sensor time ticks between two samples in the FIFO */
+            period = ((uint64_t)BMI090L_SENSOR_TIME_1600_HZ_TICKS << (BMI090L_ACCEL_ODR_1600_HZ - dev->accel_cfg.odr))
+                     << fifo_downs;
+        }
+
+        /* Collect the samples up to the sensor time frame, keeping the
+         * skipped frame count before each sample in sample_time until the
+         * times are known */
+        while ((rslt == BMI090L_OK) && (fifo->acc_byte_start_idx < fifo->length))
+        {
+            rslt = get_fifo_event(&event, fifo, dev);
+
+            if (rslt == BMI090L_OK)
+            {
+                switch (event.type)
+                {
+                    case BMI090L_FIFO_EVENT_ACCEL:
+                        if (accel_indx < (*accel_length))
+                        {
+                            accel_data[accel_indx] = event.accel;
+                            sample_time[accel_indx] = skipped;
+                            accel_indx++;
+                        }
+                        else
+                        {
+                            /* Leave the rest for the next call, it only
+                             * moves the stored samples back in time */
+                            if (full == FALSE)
+                            {
+                                resume_idx = fifo->acc_byte_start_idx - BMI090L_FIFO_MAX_FRAME_LENGTH;
+                                full = TRUE;
+                            }
+
+                            skipped++;
+                        }
+
+                        break;
+
+                    case BMI090L_FIFO_EVENT_SKIP:
+                        skipped += event.value;
+                        break;
+
+                    case BMI090L_FIFO_EVENT_SENSOR_TIME:
+
+                        /* Extend the 24 bit counter by the ticks since the last sensor time */
+                        if (timeline->valid == TRUE)
+                        {
+                            sensor_time = timeline->sensor_time +
+                                          ((event.sensor_time - (uint32_t)timeline->sensor_time) &
+                                           BMI090L_SENSOR_TIME_MASK);
+                        }
+                        else
+                        {
+                            sensor_time = event.sensor_time;
+                        }
+
+                        anchored = TRUE;
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+        }
+
+        if ((rslt >= BMI090L_OK) && (full == TRUE))
+        {
+            fifo->acc_byte_start_idx = resume_idx;
+            rslt = BMI090L_W_PARTIAL_READ;
+        }
+
+        if (rslt >= BMI090L_OK)
+        {
+            /* In FIFO mode the FIFO stops when full, so frames may be lost
+             * after the last sample. It is continued from the timeline
+             * instead, skip frames count the lost frames */
+            if ((anchored == TRUE) && ((fifo_mode == FALSE) || (timeline->valid == FALSE)))
+            {
+                /* The last frame is on the sample grid at or before the
+                 * sensor time, the last sample is earlier than that by the
+                 * frames after it */
+                if (accel_indx > 0)
+                {
+                    prev_skipped = sample_time[accel_indx - 1];
+                }
+
+                time = (sensor_time & ~(period - 1)) - (period * (skipped - prev_skipped));
+                timeline->sensor_time = sensor_time;
+                timeline->sample_time = time;
+                timeline->valid = TRUE;
+
+                /* Back-fill the earlier samples */
+                for (indx = accel_indx; indx > 0; indx--)
+                {
+                    skipped = sample_time[indx - 1];
+                    sample_time[indx - 1] = time;
+
+                    if (indx > 1)
+                    {
+                        time -= period * (1 + skipped - sample_time[indx - 2]);
+                    }
+                }
+            }
+            else if (timeline->valid == TRUE)
+            {
+                /* Continue from the last sample of the timeline */
+                time = timeline->sample_time;
+
+                for (indx = 0; indx < accel_indx; indx++)
+                {
+                    skipped = sample_time[indx];
+                    time += period * (1 + skipped - prev_skipped);
+                    prev_skipped = skipped;
+                    sample_time[indx] = time;
+                }
+
+                timeline->sample_time = time;
+
+                if (anchored == TRUE)
+                {
+                    timeline->sensor_time = sensor_time;
+                }
+            }
+            else
+            {
+                for (indx = 0; indx < accel_indx; indx++)
+                {
+                    sample_time[indx] = 0;
+                }
+
+                rslt = BMI090L_W_NO_SENSOR_TIME;
+            }
         }
+
+        (*accel_length) = accel_indx;
     }
     else
     {
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- * @brief This API sets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This API merges the accel and gyro samples of one FIFO drain into
+ * one time ordered stream.
  */
-int8_t bmi090la_set_high_g_config(const struct bmi090l_high_g_cfg *config, struct bmi090l_dev *dev)
+int8_t bmi090la_merge_fifo(const struct bmi090l_sensor_data *accel_data,
+                           const uint64_t *accel_time,
+                           uint16_t accel_length,
+                           const struct bmi090l_sensor_data *gyro_data,
+                           uint16_t gyro_length,
+                           struct bmi090l_fifo_sample *samples,
+                           uint16_t *sample_count,
+                           struct bmi090l_fifo_merger *merger,
+                           const struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint16_t accel_indx = 0;
+    uint16_t gyro_indx = 0;
+    uint16_t sample_indx = 0;
+    uint64_t accel_ns = 0;
+    uint64_t gyro_ns = 0;
 
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_HIGH_G_START_ADR + 3] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
-
-    if (rslt == BMI090L_OK)
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI090L_OK) && (accel_data != NULL) && (accel_time != NULL) && (gyro_data != NULL) &&
+        (samples != NULL) && (sample_count != NULL) && (merger != NULL))
     {
-        uint8_t idx = BMI090L_HIGH_G_START_ADR;
-
-        /* Set threshold */
-        feature_config[idx] = BMI090L_SET_BITS_POS_0(feature_config[idx], BMI090L_HIGH_G_THRES, config->threshold);
-
-        /* Set hysteresis */
-        feature_config[idx + 1] = BMI090L_SET_BITS_POS_0(feature_config[idx + 1],
-                                                         BMI090L_HIGH_G_HYST,
-                                                         config->hysteresis);
-
-        /* Set x-select */
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_X_SEL, config->select_x);
+        if ((*sample_count) < ((uint32_t)accel_length + gyro_length))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+        else
+        {
+            rslt = estimate_gyro_time(gyro_length, merger, dev);
+        }
 
-        /* Set y-select */
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_Y_SEL, config->select_y);
+        if (rslt == BMI090L_OK)
+        {
+            while ((accel_indx < accel_length) || (gyro_indx < gyro_length))
+            {
+                if (accel_indx < accel_length)
+                {
+                    accel_ns = sensor_time_to_ns(accel_time[accel_indx]);
+                }
 
-        /* Set z-select */
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_Z_SEL, config->select_z);
+                if (gyro_indx < gyro_length)
+                {
+                    gyro_ns = merger->gyro_time_ns -
+                              ((uint64_t)merger->gyro_period_ns * (uint16_t)(gyro_length - 1 - gyro_indx));
+                }
 
-        /* High-g enable */
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_ENABLE, config->enable);
+                if ((gyro_indx >= gyro_length) || ((accel_indx < accel_length) && (accel_ns <= gyro_ns)))
+                {
+                    samples[sample_indx].time_ns = accel_ns;
+                    samples[sample_indx].data = accel_data[accel_indx];
+                    samples[sample_indx].sensor = BMI090L_FIFO_SAMPLE_ACCEL;
+                    accel_indx++;
+                }
+                else
+                {
+                    samples[sample_indx].time_ns = gyro_ns;
+                    samples[sample_indx].data = gyro_data[gyro_indx];
+                    samples[sample_indx].sensor = BMI090L_FIFO_SAMPLE_GYRO;
+                    gyro_indx++;
+                }
 
-        /* Set duration */
-        feature_config[idx + 2] = BMI090L_SET_BITS_POS_0(feature_config[idx + 2], BMI090L_HIGH_G_DUR, config->duration);
+                sample_indx++;
+            }
+        }
 
-        rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t*) feature_config, 32, dev);
+        (*sample_count) = sample_indx;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This API initializes the FIFO resampler.
  */
-int8_t bmi090la_get_high_g_config(struct bmi090l_high_g_cfg *config, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_resampler_init(struct bmi090l_fifo_resampler *resampler, uint32_t period_ns)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_HIGH_G_START_ADR + 3] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+    int8_t rslt = BMI090L_OK;
 
-    if (rslt == BMI090L_OK)
+    if (resampler == NULL)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+    else if (period_ns == 0)
+    {
+        rslt = BMI090L_E_INVALID_INPUT;
+    }
+    else
     {
-        /* Define the offset in bytes for high-g select */
-        uint8_t idx = BMI090L_HIGH_G_START_ADR;
+        resampler->period_ns = period_ns;
+        resampler->time_ns = 0;
+        resampler->head = 0;
+        resampler->fill[BMI090L_FIFO_SAMPLE_ACCEL] = 0;
+        resampler->fill[BMI090L_FIFO_SAMPLE_GYRO] = 0;
+        resampler->seen = 0;
+    }
 
-        /* Get threshold */
-        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[idx], BMI090L_HIGH_G_THRES);
+    return rslt;
+}
 
-        /* Get hysteresis */
-        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[idx + 1], BMI090L_HIGH_G_HYST);
+/*!
+ * @brief This API resamples the merged FIFO stream onto a common time grid.
+ */
+int8_t bmi090la_resample_fifo(const struct bmi090l_fifo_sample *samples,
+                              uint16_t *sample_count,
+                              struct bmi090l_imu_sample *imu_data,
+                              uint16_t *imu_length,
+                              struct bmi090l_fifo_resampler *resampler)
+{
+    int8_t rslt = BMI090L_OK;
+    uint16_t sample_indx = 0;
+    uint16_t imu_indx = 0;
+    uint8_t both = (1 << BMI090L_FIFO_SAMPLE_ACCEL) | (1 << BMI090L_FIFO_SAMPLE_GYRO);
+    uint8_t sensor;
+    uint8_t slot;
+    uint64_t time;
+    const struct bmi090l_fifo_sample *sample;
+
+    if ((samples != NULL) && (sample_count != NULL) && (imu_data != NULL) && (imu_length != NULL) &&
+        (resampler != NULL))
+    {
+        while (rslt == BMI090L_OK)
+        {
+            /* Emit the grid points both sensors have passed */
+            while ((resampler->fill[BMI090L_FIFO_SAMPLE_ACCEL] > 0) &&
+                   (resampler->fill[BMI090L_FIFO_SAMPLE_GYRO] > 0) && (imu_indx < (*imu_length)))
+            {
+                resampler_emit(resampler, &imu_data[imu_indx]);
+                imu_indx++;
+            }
 
-        /* Get x_select */
-        config->select_x = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_X_SEL);
+            if ((resampler->fill[BMI090L_FIFO_SAMPLE_ACCEL] > 0) && (resampler->fill[BMI090L_FIFO_SAMPLE_GYRO] > 0))
+            {
+                rslt = BMI090L_W_PARTIAL_READ;
+            }
+            else if (sample_indx >= (*sample_count))
+            {
+                break;
+            }
+            else
+            {
+                sample = &samples[sample_indx];
+                sensor = sample->sensor;
 
-        /* Get y_select */
-        config->select_y = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_Y_SEL);
+                if (sensor > BMI090L_FIFO_SAMPLE_GYRO)
+                {
+                    rslt = BMI090L_E_INVALID_INPUT;
+                }
+                else if (resampler->seen == both)
+                {
+                    /* Interpolate at the grid points up to the sample */
+                    time = resampler->time_ns + ((uint64_t)resampler->period_ns * resampler->fill[sensor]);
 
-        /* Get z_select */
-        config->select_z = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_Z_SEL);
+                    while ((rslt == BMI090L_OK) && (time <= sample->time_ns))
+                    {
+                        if (resampler->fill[sensor] < BMI090L_FIFO_RESAMPLE_DEPTH)
+                        {
+                            slot = (uint8_t)((resampler->head + resampler->fill[sensor]) % BMI090L_FIFO_RESAMPLE_DEPTH);
+                            interpolate_sample(&resampler->last[sensor],
+                                               sample,
+                                               time,
+                                               &resampler->pending[sensor][slot]);
+                            resampler->fill[sensor]++;
+                            time += resampler->period_ns;
+                        }
+                        else if (imu_indx < (*imu_length))
+                        {
+                            /* Too far ahead of the other sensor */
+                            resampler_emit(resampler, &imu_data[imu_indx]);
+                            imu_indx++;
+                        }
+                        else
+                        {
+                            /* Continue with this sample in the next call */
+                            rslt = BMI090L_W_PARTIAL_READ;
+                        }
+                    }
+                }
+                else if ((resampler->seen | (1 << sensor)) == both)
+                {
+                    /* The grid starts after the first sample of both sensors */
+                    resampler->time_ns = ((sample->time_ns / resampler->period_ns) + 1) * resampler->period_ns;
+                }
 
-        /* Get high-g enable */
-        config->enable = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_HIGH_G_ENABLE);
+                if (rslt == BMI090L_OK)
+                {
+                    resampler->last[sensor] = *sample;
+                    resampler->seen |= (uint8_t)(1 << sensor);
+                    sample_indx++;
+                }
+            }
+        }
 
-        /* Get duration */
-        config->duration = BMI090L_GET_BITS_POS_0(feature_config[idx + 2], BMI090L_HIGH_G_DUR);
+        (*sample_count) = sample_indx;
+        (*imu_length) = imu_indx;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets high-g configurations like threshold,
- * hysteresis, duration, and output configuration.
+ * @brief This API initializes the FIFO watermark controller.
  */
-int8_t bmi090la_set_low_g_config(const struct bmi090l_low_g_cfg *config, struct bmi090l_dev *dev)
+int8_t bmi090la_fifo_wm_ctrl_init(struct bmi090l_fifo_wm_ctrl *ctrl,
+                                  uint16_t accel_wm,
+                                  uint8_t gyro_wm,
+                                  struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t data = 0;
 
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_LOW_G_START_ADR + 3] = { 0 };
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
 
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_FIFO_WM_CTRL_INIT);
 
-    if (rslt == BMI090L_OK)
+    if ((rslt == BMI090L_OK) && (ctrl != NULL))
     {
-        uint8_t idx = BMI090L_LOW_G_START_ADR;
+        /* The down-sampling is fixed while the controller runs */
+        if (accel_wm != 0)
+        {
+            rslt = bmi090la_get_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
+        }
 
-        /* Set threshold */
-        feature_config[idx] = BMI090L_SET_BITS_POS_0(feature_config[idx], BMI090L_LOW_G_THRES, config->threshold);
+        if (rslt == BMI090L_OK)
+        {
+            ctrl->latency_us = 0;
+            ctrl->latency_dev_us = 0;
+            ctrl->latency_peak_us = 0;
+            ctrl->accel_wm = accel_wm;
+            ctrl->gyro_wm = gyro_wm;
+            ctrl->accel_downs = BMI090L_GET_BITS(data, BMI090L_ACC_FIFO_DOWNS);
+            ctrl->valid = FALSE;
+        }
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
 
-        /* Set hysteresis */
-        feature_config[idx +
-                       1] = BMI090L_SET_BITS_POS_0(feature_config[idx + 1], BMI090L_LOW_G_HYST, config->hysteresis);
+    BMI090L_STATS_EXIT(dev);
 
-        /* Low-g enable */
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_LOW_G_ENABLE, config->enable);
+    return rslt;
+}
 
-        /* Set duration */
-        feature_config[idx + 2] = BMI090L_SET_BITS_POS_0(feature_config[idx + 2], BMI090L_LOW_G_DUR, config->duration);
+/*!
+ * @brief This API retunes the accel and gyro FIFO watermarks to the
+ * measured service latency.
+ */
+int8_t bmi090la_update_fifo_wm(struct bmi090l_fifo_wm_ctrl *ctrl,
+                               uint16_t accel_fill,
+                               uint8_t gyro_fill,
+                               struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data = 0;
+    uint8_t saturated = FALSE;
+    uint16_t wm;
+    uint64_t accel_period = 0;
+    uint64_t gyro_period = 0;
+    uint64_t latency = 0;
+    uint64_t sample;
+    uint64_t margin;
+    int64_t error;
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_UPDATE_FIFO_WM);
+
+    if ((rslt == BMI090L_OK) && (ctrl != NULL))
+    {
+        /* Frame periods of the controlled FIFOs */
+        if (ctrl->accel_wm != 0)
+        {
+            if ((dev->accel_cfg.odr < BMI090L_ACCEL_ODR_12_5_HZ) || (dev->accel_cfg.odr > BMI090L_ACCEL_ODR_1600_HZ))
+            {
+                rslt = BMI090L_E_INVALID_CONFIG;
+            }
+            else
+            {
+                accel_period =
+                    sensor_time_to_ns(((uint64_t)BMI090L_SENSOR_TIME_1600_HZ_TICKS <<
+                                       (BMI090L_ACCEL_ODR_1600_HZ - dev->accel_cfg.odr)) << ctrl->accel_downs);
+            }
+        }
+
+        if ((rslt == BMI090L_OK) && (ctrl->gyro_wm != 0))
+        {
+            gyro_period = get_gyro_period_ns(dev->gyro_cfg.odr);
+            if (gyro_period == 0)
+            {
+                rslt = BMI090L_E_INVALID_CONFIG;
+            }
+        }
+
+        if (rslt == BMI090L_OK)
+        {
+            /* The frames beyond the watermark arrived between the interrupt
+             * and the drain */
+            if ((ctrl->accel_wm != 0) && (accel_fill >= ctrl->accel_wm))
+            {
+                sample = ((uint64_t)(accel_fill - ctrl->accel_wm) / BMI090L_FIFO_MAX_FRAME_LENGTH) * accel_period;
+                latency = (sample > latency) ? sample : latency;
+                saturated |= (accel_fill + BMI090L_FIFO_MAX_FRAME_LENGTH) > BMI090L_ACCEL_FIFO_SIZE;
+            }
+
+            if ((ctrl->gyro_wm != 0) && (gyro_fill >= ctrl->gyro_wm))
+            {
+                sample = (uint64_t)(gyro_fill - ctrl->gyro_wm) * gyro_period;
+                latency = (sample > latency) ? sample : latency;
+                saturated |= (gyro_fill + 1) >= BMI090L_GYRO_FIFO_MAX_FRAMES;
+            }
+
+            latency /= 1000;
+
+            if (ctrl->valid != TRUE)
+            {
+                ctrl->latency_us = (uint32_t)latency;
+                ctrl->latency_dev_us = (uint32_t)(latency / 2);
+                ctrl->valid = TRUE;
+            }
+            else
+            {
+                error = (int64_t)latency - ctrl->latency_us;
+                ctrl->latency_us = (uint32_t)((int64_t)ctrl->latency_us + (error / 8));
+                error = (error < 0) ? -error : error;
+                error -= ctrl->latency_dev_us;
+                ctrl->latency_dev_us = (uint32_t)((int64_t)ctrl->latency_dev_us + (error / 4));
+            }
+
+            if (saturated == TRUE)
+            {
+                /* The true latency is unknown, back off at once */
+                ctrl->latency_us = (ctrl->latency_us > latency) ? ctrl->latency_us : (uint32_t)latency;
+                if (ctrl->latency_dev_us < ctrl->latency_us)
+                {
+                    ctrl->latency_dev_us = ctrl->latency_us;
+                }
+            }
+
+            /* Latency peaks are rare but remembered for a while */
+            ctrl->latency_peak_us -= ctrl->latency_peak_us >> BMI090L_FIFO_WM_PEAK_DECAY_SHIFT;
+            if (latency > ctrl->latency_peak_us)
+            {
+                ctrl->latency_peak_us = (uint32_t)latency;
+            }
+
+            margin = (uint64_t)ctrl->latency_us + (4 * (uint64_t)ctrl->latency_dev_us);
+            if (margin < ctrl->latency_peak_us)
+            {
+                margin = ctrl->latency_peak_us;
+            }
+
+            margin = (margin + BMI090L_FIFO_WM_MARGIN_US) * 1000;
+
+            if (ctrl->accel_wm != 0)
+            {
+                wm = (uint16_t)(get_fifo_wm_frames(margin, accel_period,
+                                                   BMI090L_ACCEL_FIFO_SIZE / BMI090L_FIFO_MAX_FRAME_LENGTH) *
+                                BMI090L_FIFO_MAX_FRAME_LENGTH);
+
+                if (fifo_wm_changed(ctrl->accel_wm, wm, BMI090L_ACCEL_FIFO_SIZE) == TRUE)
+                {
+                    rslt = bmi090la_set_fifo_wm(wm, dev);
+                    if (rslt == BMI090L_OK)
+                    {
+                        ctrl->accel_wm = wm;
+                    }
+                }
+            }
+
+            if ((rslt == BMI090L_OK) && (ctrl->gyro_wm != 0))
+            {
+                wm = get_fifo_wm_frames(margin, gyro_period, BMI090L_GYRO_FIFO_MAX_FRAMES);
+
+                if (fifo_wm_changed(ctrl->gyro_wm, wm, BMI090L_GYRO_FIFO_MAX_FRAMES) == TRUE)
+                {
+                    rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_CONFIG0, &data, 1, dev);
+                    if (rslt == BMI090L_OK)
+                    {
+                        data = BMI090L_SET_BITS_POS_0(data, BMI090L_GYRO_FIFO_WM_LEVEL, wm);
+                        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_FIFO_CONFIG0, &data, 1, dev);
+                    }
+
+                    if (rslt == BMI090L_OK)
+                    {
+                        ctrl->gyro_wm = (uint8_t)wm;
+                    }
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the down sampling rates which is configured for
+ * accelerometer FIFO data.
+ */
+int8_t bmi090la_get_fifo_down_sample(uint8_t *fifo_downs, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store sampling rate */
+    uint8_t data = 0;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_FIFO_DOWN_SAMPLE);
+
+    if (fifo_downs != NULL)
+    {
+        /* Read the accelerometer FIFO down data sampling rate */
+        rslt = bmi090la_get_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
+        if (rslt == BMI090L_OK)
+        {
+            (*fifo_downs) = BMI090L_GET_BITS(data, BMI090L_ACC_FIFO_DOWNS);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the down-sampling rates for accelerometer
+ * FIFO data.
+ *
+ * @note Reduction of sample rate by a factor 2**fifo_downs
+ */
+int8_t bmi090la_set_fifo_down_sample(uint8_t fifo_downs, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store sampling rate */
+    uint8_t data = 0;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_FIFO_DOWN_SAMPLE);
+
+    /* Set the accelerometer FIFO down sampling rate */
+    rslt = bmi090la_get_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
+    if (rslt == BMI090L_OK)
+    {
+        data = BMI090L_SET_BITS(data, BMI090L_ACC_FIFO_DOWNS, fifo_downs);
+        rslt = bmi090la_set_regs(BMI090L_FIFO_DOWNS_ADDR, &data, 1, dev);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API is used to enable/disable and configure the data synchronization
+ *  feature.
+ */
+int8_t bmi090la_configure_data_synchronization(struct bmi090l_data_sync_cfg sync_cfg, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint16_t data[BMI090L_ACCEL_DATA_SYNC_LEN];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_CONFIGURE_DATA_SYNCHRONIZATION);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if (rslt == BMI090L_OK)
+    {
+        /* Change sensor meas config */
+        switch (sync_cfg.mode)
+        {
+            case BMI090L_ACCEL_DATA_SYNC_MODE_2000HZ:
+                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_1600_HZ;
+                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
+                dev->gyro_cfg.odr = BMI090L_GYRO_BW_230_ODR_2000_HZ;
+                dev->gyro_cfg.bw = BMI090L_GYRO_BW_230_ODR_2000_HZ;
+                break;
+            case BMI090L_ACCEL_DATA_SYNC_MODE_1000HZ:
+                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_800_HZ;
+                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
+                dev->gyro_cfg.odr = BMI090L_GYRO_BW_116_ODR_1000_HZ;
+                dev->gyro_cfg.bw = BMI090L_GYRO_BW_116_ODR_1000_HZ;
+                break;
+            case BMI090L_ACCEL_DATA_SYNC_MODE_400HZ:
+                dev->accel_cfg.odr = BMI090L_ACCEL_ODR_400_HZ;
+                dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
+                dev->gyro_cfg.odr = BMI090L_GYRO_BW_47_ODR_400_HZ;
+                dev->gyro_cfg.bw = BMI090L_GYRO_BW_47_ODR_400_HZ;
+                break;
+            default:
+                break;
+        }
+
+        rslt = bmi090la_set_meas_conf(dev);
+
+        if (rslt == BMI090L_OK)
+        {
+            rslt = bmi090lg_set_meas_conf(dev);
+        }
+
+        if (rslt == BMI090L_OK)
+        {
+            /* Enable data synchronization */
+            data[0] = (sync_cfg.mode & BMI090L_ACCEL_DATA_SYNC_MODE_MASK);
+            rslt = bmi090la_write_feature_config(BMI090L_ACCEL_DATA_SYNC_ADR,
+                                                 &data[0],
+                                                 BMI090L_ACCEL_DATA_SYNC_LEN,
+                                                 dev);
+        }
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API is used to enable/disable and configure the anymotion
+ *  feature.
+ */
+int8_t bmi090la_configure_anymotion(struct bmi090l_anymotion_cfg anymotion_cfg, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint16_t data[BMI090L_ACCEL_ANYMOTION_LEN];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_CONFIGURE_ANYMOTION);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if (rslt == BMI090L_OK)
+    {
+        /* Enable data synchronization */
+        data[0] = (anymotion_cfg.threshold & BMI090L_ACCEL_ANYMOTION_THRESHOLD_MASK);
+        data[0] |=
+            ((anymotion_cfg.enable << BMI090L_ACCEL_ANYMOTION_NOMOTION_SEL_SHIFT) &
+             BMI090L_ACCEL_ANYMOTION_NOMOTION_SEL_MASK);
+        data[1] = (anymotion_cfg.duration & BMI090L_ACCEL_ANYMOTION_DURATION_MASK);
+        data[1] |= ((anymotion_cfg.x_en << BMI090L_ACCEL_ANYMOTION_X_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_X_EN_MASK);
+        data[1] |= ((anymotion_cfg.y_en << BMI090L_ACCEL_ANYMOTION_Y_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_Y_EN_MASK);
+        data[1] |= ((anymotion_cfg.z_en << BMI090L_ACCEL_ANYMOTION_Z_EN_SHIFT) & BMI090L_ACCEL_ANYMOTION_Z_EN_MASK);
+        rslt = bmi090la_write_feature_config(BMI090L_ACCEL_ANYMOTION_ADR, &data[0], BMI090L_ACCEL_ANYMOTION_LEN, dev);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the synchronized accel & gyro data from the sensor,
+ *  store it in the bmi090l_sensor_data structure instance
+ *  passed by the user.
+ */
+int8_t bmi090la_get_synchronized_data(struct bmi090l_sensor_data *accel,
+                                      struct bmi090l_sensor_data *gyro,
+                                      struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_addr, data[6];
+    uint8_t lsb, msb;
+    uint16_t msblsb;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_SYNCHRONIZED_DATA);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (accel != NULL) && (gyro != NULL))
+    {
+        /* Read accel x,y sensor data */
+        reg_addr = BMI090L_REG_ACCEL_GP_0;
+        rslt = bmi090la_get_regs(reg_addr, &data[0], 4, dev);
+
+        if (rslt == BMI090L_OK)
+        {
+            /* Read accel sensor data */
+            reg_addr = BMI090L_REG_ACCEL_GP_4;
+            rslt = bmi090la_get_regs(reg_addr, &data[4], 2, dev);
+
+            if (rslt == BMI090L_OK)
+            {
+                lsb = data[0];
+                msb = data[1];
+                msblsb = (msb << 8) | lsb;
+                accel->x = ((int16_t) msblsb); /* Data in X axis */
+
+                lsb = data[2];
+                msb = data[3];
+                msblsb = (msb << 8) | lsb;
+                accel->y = ((int16_t) msblsb); /* Data in Y axis */
+
+                lsb = data[4];
+                msb = data[5];
+                msblsb = (msb << 8) | lsb;
+                accel->z = ((int16_t) msblsb); /* Data in Z axis */
+
+                /* Read gyro sensor data */
+                rslt = bmi090lg_get_data(gyro, dev);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API reads the synchronized accel & gyro data and the accel
+ *  data interrupt status with one accel batch and one gyro read.
+ */
+int8_t bmi090la_get_synchronized_data_status(struct bmi090l_sensor_data *accel,
+                                             struct bmi090l_sensor_data *gyro,
+                                             uint8_t *int_status,
+                                             struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data[7];
+    uint8_t *gp;
+    struct bmi090l_xfer_seg seg[2];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_SYNCHRONIZED_DATA_STATUS);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (accel != NULL) && (gyro != NULL))
+    {
+        /* The interrupt status sits right in front of GP_0 to GP_3. GP_4 is read on its own,
+         * a burst across the FIFO data register in between would stop on it.
+         */
+        if (int_status != NULL)
+        {
+            seg[0].reg_addr = BMI090L_REG_ACCEL_INT_STAT_1;
+            seg[0].len = 5;
+        }
+        else
+        {
+            seg[0].reg_addr = BMI090L_REG_ACCEL_GP_0;
+            seg[0].len = 4;
+        }
+
+        seg[0].dir = BMI090L_XFER_READ;
+        seg[0].data = &data[0];
+        gp = &data[seg[0].len - 4];
+        seg[1].reg_addr = BMI090L_REG_ACCEL_GP_4;
+        seg[1].dir = BMI090L_XFER_READ;
+        seg[1].data = &gp[4];
+        seg[1].len = 2;
+
+        /* Both accel reads go out as one batch on a vectored interface */
+        rslt = xfer_regs(seg, 2, dev);
+
+        if (rslt == BMI090L_OK)
+        {
+            if (int_status != NULL)
+            {
+                (*int_status) = data[0];
+            }
+
+            accel->x = (int16_t)((uint16_t)(gp[1] << 8) | gp[0]); /* Data in X axis */
+            accel->y = (int16_t)((uint16_t)(gp[3] << 8) | gp[2]); /* Data in Y axis */
+            accel->z = (int16_t)((uint16_t)(gp[5] << 8) | gp[4]); /* Data in Z axis */
+
+            /* Read gyro sensor data */
+            rslt = bmi090lg_get_data(gyro, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API configures the synchronization interrupt
+ *  based on the user settings in the bmi090l_int_cfg
+ *  structure instance.
+ */
+int8_t bmi090la_set_data_sync_int_config(const struct bmi090l_int_cfg *int_config, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_DATA_SYNC_INT_CONFIG);
+
+    if (int_config != NULL)
+    {
+        /* Configure accel sync data ready interrupt configuration */
+        rslt = bmi090la_set_int_config(&int_config->accel_int_config_1, dev);
+        if (rslt == BMI090L_OK)
+        {
+            rslt = bmi090la_set_int_config(&int_config->accel_int_config_2, dev);
+            if (rslt == BMI090L_OK)
+            {
+                /* Configure gyro data ready interrupt configuration */
+                rslt = bmi090lg_set_int_config(&int_config->gyro_int_config_1, dev);
+                if (rslt == BMI090L_OK)
+                {
+                    rslt = bmi090lg_set_int_config(&int_config->gyro_int_config_2, dev);
+                }
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets accel feature interrupt status
+ */
+int8_t bmi090la_get_data_int_status(uint8_t *int_status, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t status = 0;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_DATA_INT_STATUS);
+
+    if (int_status != NULL)
+    {
+        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT_STAT_1, &status, 1, dev);
+        if (rslt == BMI090L_OK)
+        {
+            (*int_status) = status;
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets high-g configurations like threshold,
+ * hysteresis, duration, and output configuration.
+ */
+int8_t bmi090la_set_high_g_config(const struct bmi090l_high_g_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[3] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_HIGH_G_CONFIG);
+
+    rslt = feature_get_words(BMI090L_HIGH_G_START_ADR, feature_config, 3, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Set threshold */
+        feature_config[0] = BMI090L_SET_BITS_POS_0(feature_config[0], BMI090L_HIGH_G_THRES, config->threshold);
+
+        /* Set hysteresis */
+        feature_config[1] = BMI090L_SET_BITS_POS_0(feature_config[1], BMI090L_HIGH_G_HYST, config->hysteresis);
+
+        /* Set x-select */
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_HIGH_G_X_SEL, config->select_x);
+
+        /* Set y-select */
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_HIGH_G_Y_SEL, config->select_y);
+
+        /* Set z-select */
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_HIGH_G_Z_SEL, config->select_z);
+
+        /* High-g enable */
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_HIGH_G_ENABLE, config->enable);
+
+        /* Set duration */
+        feature_config[2] = BMI090L_SET_BITS_POS_0(feature_config[2], BMI090L_HIGH_G_DUR, config->duration);
+
+        rslt = bmi090la_write_feature_config(BMI090L_HIGH_G_START_ADR, feature_config, 3, dev);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets high-g configurations like threshold,
+ * hysteresis, duration, and output configuration.
+ */
+int8_t bmi090la_get_high_g_config(struct bmi090l_high_g_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[3] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_HIGH_G_CONFIG);
+
+    rslt = feature_get_words(BMI090L_HIGH_G_START_ADR, feature_config, 3, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Get threshold */
+        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[0], BMI090L_HIGH_G_THRES);
+
+        /* Get hysteresis */
+        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[1], BMI090L_HIGH_G_HYST);
+
+        /* Get x_select */
+        config->select_x = BMI090L_GET_BITS(feature_config[1], BMI090L_HIGH_G_X_SEL);
+
+        /* Get y_select */
+        config->select_y = BMI090L_GET_BITS(feature_config[1], BMI090L_HIGH_G_Y_SEL);
+
+        /* Get z_select */
+        config->select_z = BMI090L_GET_BITS(feature_config[1], BMI090L_HIGH_G_Z_SEL);
+
+        /* Get high-g enable */
+        config->enable = BMI090L_GET_BITS(feature_config[1], BMI090L_HIGH_G_ENABLE);
+
+        /* Get duration */
+        config->duration = BMI090L_GET_BITS_POS_0(feature_config[2], BMI090L_HIGH_G_DUR);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets high-g configurations like threshold,
+ * hysteresis, duration, and output configuration.
+ */
+int8_t bmi090la_set_low_g_config(const struct bmi090l_low_g_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[3] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_LOW_G_CONFIG);
+
+    rslt = feature_get_words(BMI090L_LOW_G_START_ADR, feature_config, 3, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Set threshold */
+        feature_config[0] = BMI090L_SET_BITS_POS_0(feature_config[0], BMI090L_LOW_G_THRES, config->threshold);
+
+        /* Set hysteresis */
+        feature_config[1] = BMI090L_SET_BITS_POS_0(feature_config[1], BMI090L_LOW_G_HYST, config->hysteresis);
+
+        /* Low-g enable */
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_LOW_G_ENABLE, config->enable);
+
+        /* Set duration */
+        feature_config[2] = BMI090L_SET_BITS_POS_0(feature_config[2], BMI090L_LOW_G_DUR, config->duration);
+
+        rslt = bmi090la_write_feature_config(BMI090L_LOW_G_START_ADR, feature_config, 3, dev);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets low-g configurations like threshold,
+ * hysteresis and duration
+ */
+int8_t bmi090la_get_low_g_config(struct bmi090l_low_g_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[3] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_LOW_G_CONFIG);
+
+    rslt = feature_get_words(BMI090L_LOW_G_START_ADR, feature_config, 3, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Get threshold */
+        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[0], BMI090L_LOW_G_THRES);
+
+        /* Get hysteresis */
+        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[1], BMI090L_LOW_G_HYST);
+
+        /* Get low-g enable */
+        config->enable = BMI090L_GET_BITS(feature_config[1], BMI090L_LOW_G_ENABLE);
+
+        /* Get duration */
+        config->duration = BMI090L_GET_BITS_POS_0(feature_config[2], BMI090L_LOW_G_DUR);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets orientation configurations like upside/down
+ * detection, symmetrical modes, blocking mode, theta and hysteresis
+ *
+ */
+int8_t bmi090la_set_orient_config(const struct bmi090l_orient_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[2] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_ORIENT_CONFIG);
+
+    rslt = feature_get_words(BMI090L_ORIENT_START_ADR, feature_config, 2, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Set orientation feature - enabled/disabled */
+        feature_config[0] = BMI090L_SET_BITS_POS_0(feature_config[0], BMI090L_ORIENT_ENABLE, config->enable);
+
+        /* Set upside/down detection */
+        feature_config[0] = BMI090L_SET_BITS(feature_config[0], BMI090L_ORIENT_UP_DOWN, config->ud_en);
+
+        /* Set symmetrical modes */
+        feature_config[0] = BMI090L_SET_BITS(feature_config[0], BMI090L_ORIENT_SYMM_MODE, config->mode);
+
+        /* Set blocking mode */
+        feature_config[0] = BMI090L_SET_BITS(feature_config[0], BMI090L_ORIENT_BLOCK_MODE, config->blocking);
+
+        /* Set theta */
+        feature_config[0] = BMI090L_SET_BITS(feature_config[0], BMI090L_ORIENT_THETA, config->theta);
+
+        /* Set hysteresis */
+        feature_config[1] = BMI090L_SET_BITS_POS_0(feature_config[1], BMI090L_ORIENT_HYST, config->hysteresis);
+
+        rslt = bmi090la_write_feature_config(BMI090L_ORIENT_START_ADR, feature_config, 2, dev);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets orientation configurations like upside/down
+ * detection, symmetrical modes, blocking mode, theta, hysteresis and output
+ * configuration.
+ */
+int8_t bmi090la_get_orient_config(struct bmi090l_orient_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[2] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_ORIENT_CONFIG);
+
+    rslt = feature_get_words(BMI090L_ORIENT_START_ADR, feature_config, 2, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        /* Get orientation feature - enabled/disabled */
+        config->enable = BMI090L_GET_BITS_POS_0(feature_config[0], BMI090L_ORIENT_ENABLE);
+
+        /* Get upside/down detection */
+        config->ud_en = BMI090L_GET_BITS(feature_config[0], BMI090L_ORIENT_UP_DOWN);
+
+        /* Get symmetrical modes */
+        config->mode = BMI090L_GET_BITS(feature_config[0], BMI090L_ORIENT_SYMM_MODE);
+
+        /* Get blocking mode */
+        config->blocking = BMI090L_GET_BITS(feature_config[0], BMI090L_ORIENT_BLOCK_MODE);
+
+        /* Get theta */
+        config->theta = BMI090L_GET_BITS(feature_config[0], BMI090L_ORIENT_THETA);
+
+        /* Get hysteresis */
+        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[1], BMI090L_ORIENT_HYST);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API sets no-motion configurations like axes select,
+ * duration, threshold and output-configuration.
+ */
+int8_t bmi090la_set_no_motion_config(const struct bmi090l_no_motion_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[2] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_NO_MOTION_CONFIG);
+
+    rslt = feature_get_words(BMI090L_NO_MOTION_START_ADR, feature_config, 2, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        feature_config[0] = BMI090L_SET_BITS_POS_0(feature_config[0], BMI090L_NO_MOTION_THRESHOLD, config->threshold);
+
+        feature_config[0] = BMI090L_SET_BITS(feature_config[0], BMI090L_NO_MOTION_SEL, config->enable);
+
+        feature_config[1] = BMI090L_SET_BITS_POS_0(feature_config[1], BMI090L_NO_MOTION_DURATION, config->duration);
+
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_NO_MOTION_X_EN, config->select_x);
+
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_NO_MOTION_Y_EN, config->select_y);
+
+        feature_config[1] = BMI090L_SET_BITS(feature_config[1], BMI090L_NO_MOTION_Z_EN, config->select_z);
+
+        rslt = bmi090la_write_feature_config(BMI090L_NO_MOTION_START_ADR, feature_config, 2, dev);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+int8_t bmi090la_get_no_motion_config(struct bmi090l_no_motion_cfg *config, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Array to define the feature configuration */
+    uint16_t feature_config[2] = { 0 };
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_NO_MOTION_CONFIG);
+
+    rslt = feature_get_words(BMI090L_NO_MOTION_START_ADR, feature_config, 2, dev);
+
+    if ((rslt == BMI090L_OK) && (config != NULL))
+    {
+        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[0], BMI090L_NO_MOTION_THRESHOLD);
+
+        config->enable = BMI090L_GET_BITS(feature_config[0], BMI090L_NO_MOTION_SEL);
+
+        config->duration = BMI090L_GET_BITS_POS_0(feature_config[1], BMI090L_NO_MOTION_DURATION);
+
+        config->select_x = BMI090L_GET_BITS(feature_config[1], BMI090L_NO_MOTION_X_EN);
+
+        config->select_y = BMI090L_GET_BITS(feature_config[1], BMI090L_NO_MOTION_Y_EN);
+
+        config->select_z = BMI090L_GET_BITS(feature_config[1], BMI090L_NO_MOTION_Z_EN);
+    }
+    else if (rslt == BMI090L_OK)
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the output values of orientation: portrait-
+ * landscape and face up-down.
+ */
+int8_t bmi090la_get_orient_output(struct bmi090l_orient_out *orient_out, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_ORIENT_OUTPUT);
+
+    /* Search for orientation output feature and extract its configuration details */
+    rslt = bmi090la_get_regs(BMI090L_REG_ORIENT_HIGHG_OUT, &data, 1, dev);
+    if (rslt == BMI090L_OK)
+    {
+        orient_out->portrait_landscape = BMI090L_GET_BITS_POS_0(data, BMI090L_ORIENT_PORTRAIT_LANDSCAPE);
+        orient_out->faceup_down = BMI090L_GET_BITS(data, BMI090L_ORIENT_FACEUP_DOWN);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the output values of high_g: Axis and Direction
+ */
+int8_t bmi090la_get_high_g_output(struct bmi090l_high_g_out *high_g_out, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_HIGH_G_OUTPUT);
+
+    /* Search for high-g output feature and extract its configuration details */
+    rslt = bmi090la_get_regs(BMI090L_REG_ORIENT_HIGHG_OUT, &data, 1, dev);
+    if (rslt == BMI090L_OK)
+    {
+        high_g_out->x = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_X);
+        high_g_out->y = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_Y);
+        high_g_out->z = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_Z);
+        high_g_out->direction = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_DIRECTION);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API gets accel feature interrupt status
+ */
+int8_t bmi090la_get_feat_int_status(uint8_t *int_status, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t status = 0;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_FEAT_INT_STATUS);
+
+    if (int_status != NULL)
+    {
+        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT_STAT_0, &status, 1, dev);
+        if (rslt == BMI090L_OK)
+        {
+            (*int_status) = status;
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API gets the re-mapped x, y and z axes from the sensor and
+ * updates the values in the device structure.
+ */
+int8_t bmi090la_get_remap_axes(struct bmi090l_remap *remapped_axis, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_REMAP_AXES);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI090L_OK) && (remapped_axis != NULL))
+    {
+        /* Get the re-mapped axes from the sensor */
+        rslt = get_remap_axes(&dev->remap, dev);
+        if (rslt == BMI090L_OK)
+        {
+            /* Store the receive re-mapped axis and sign from device structure */
+            receive_remap_axis(dev->remap.x_axis, dev->remap.x_axis_sign, &remapped_axis->x);
+            receive_remap_axis(dev->remap.y_axis, dev->remap.y_axis_sign, &remapped_axis->y);
+            receive_remap_axis(dev->remap.z_axis, dev->remap.z_axis_sign, &remapped_axis->z);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the re-mapped x, y and z axes to the sensor and
+ * updates the them in the device structure.
+ */
+int8_t bmi090la_set_remap_axes(const struct bmi090l_remap *remapped_axis, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Variable to store all the re-mapped axes */
+    uint8_t remap_axes = 0;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_SET_REMAP_AXES);
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI090L_OK) && (remapped_axis != NULL))
+    {
+        /* Check whether all the axes are re-mapped */
+        remap_axes = remapped_axis->x | remapped_axis->y | remapped_axis->z;
+
+        /* If all the axes are re-mapped */
+        if ((remap_axes & BMI090L_AXIS_MASK) == BMI090L_AXIS_MASK)
+        {
+            /* Store the value of re-mapped in device structure */
+            assign_remap_axis(remapped_axis->x, &dev->remap.x_axis, &dev->remap.x_axis_sign);
+            assign_remap_axis(remapped_axis->y, &dev->remap.y_axis, &dev->remap.y_axis_sign);
+            assign_remap_axis(remapped_axis->z, &dev->remap.z_axis, &dev->remap.z_axis_sign);
+
+            /* Set the re-mapped axes in the sensor */
+            rslt = set_remap_axes(&dev->remap, dev);
+        }
+        else
+        {
+            rslt = BMI090L_E_REMAP_ERROR;
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ * @brief This API applies the axes re-mapping kept in the device structure
+ * to a batch of samples.
+ */
+int8_t bmi090la_remap_data(struct bmi090l_sensor_data *data, uint16_t count, struct bmi090l_dev *dev)
+{
+    /* Variable to define error */
+    int8_t rslt;
+
+    /* Null-pointer check */
+    rslt = null_ptr_check(dev);
+    if ((rslt == BMI090L_OK) && (data != NULL))
+    {
+        get_remapped_data(data, count, dev);
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API is used to get the config file major and minor information.
+ */
+int8_t bmi090la_get_version_config(uint16_t *config_major, uint16_t *config_minor, struct bmi090l_dev *dev)
+{
+    /* Variable to define LSB and MSB */
+    uint16_t lsb_msb = 0;
+
+    /* Result of api are returned to this variable */
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LA_GET_VERSION_CONFIG);
+
+    if ((config_major != NULL) && (config_minor != NULL))
+    {
+        /* Get config file identification from the sensor */
+        rslt = feature_get_words(BMI090L_CONFIG_ID_WORD, &lsb_msb, 1, dev);
+
+        if (rslt == BMI090L_OK)
+        {
+            /* Get major and minor version */
+            *config_major = BMI090L_GET_BITSLICE(lsb_msb, BMI090L_CONFIG_MAJOR);
+            *config_minor = BMI090L_GET_BITS_POS_0(lsb_msb, BMI090L_CONFIG_MINOR);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+#ifdef BMI090L_BUS_STATS
+
+/*!
+ * @brief This API clears the bus statistics of the device.
+ */
+int8_t bmi090l_stats_reset(struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    const struct bmi090l_api_stats zero = { 0 };
+    uint8_t indx;
+
+    if ((dev != NULL) && (dev->stats != NULL))
+    {
+        for (indx = 0; indx < BMI090L_STATS_API_MAX; indx++)
+        {
+            dev->stats->api[indx] = zero;
+        }
+
+        dev->stats->cur_api = BMI090L_STATS_API_OTHER;
+        dev->stats->depth = 0;
+        dev->stats->start_us = 0;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API marks the entry of a public API. Only the
+ * outermost call is counted and timed.
+ */
+void bmi090l_stats_enter(struct bmi090l_dev *dev, uint8_t api)
+{
+    if ((dev != NULL) && (dev->stats != NULL))
+    {
+        if (dev->stats->depth == 0)
+        {
+            dev->stats->cur_api = (api < BMI090L_STATS_API_MAX) ? api : BMI090L_STATS_API_OTHER;
+            dev->stats->api[dev->stats->cur_api].calls++;
+
+            if (dev->timestamp_us != NULL)
+            {
+                dev->stats->start_us = dev->timestamp_us(dev->intf_ptr_accel);
+            }
+        }
+
+        dev->stats->depth++;
+    }
+}
+
+/*!
+ * @brief This internal API marks the exit of a public API and records the
+ * latency of the outermost call.
+ */
+void bmi090l_stats_exit(struct bmi090l_dev *dev)
+{
+    struct bmi090l_api_stats *api_stats;
+    uint32_t elapsed;
+    uint32_t log;
+    uint8_t bucket = 0;
+
+    if ((dev != NULL) && (dev->stats != NULL) && (dev->stats->depth > 0))
+    {
+        dev->stats->depth--;
+
+        if (dev->stats->depth == 0)
+        {
+            api_stats = &dev->stats->api[dev->stats->cur_api];
+
+            if (dev->timestamp_us != NULL)
+            {
+                /* Unsigned difference handles the wrap of the timestamp */
+                elapsed = dev->timestamp_us(dev->intf_ptr_accel) - dev->stats->start_us;
+
+                for (log = elapsed; (log != 0) && (bucket < (BMI090L_STATS_LAT_BUCKETS - 1)); log >>= 1)
+                {
+                    bucket++;
+                }
+
+                api_stats->lat_hist[bucket]++;
+
+                if (elapsed > api_stats->max_us)
+                {
+                    api_stats->max_us = elapsed;
+                }
+            }
+
+            dev->stats->cur_api = BMI090L_STATS_API_OTHER;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API counts a bus transaction against the current API.
+ */
+void bmi090l_stats_bus(struct bmi090l_dev *dev, uint8_t dir, uint32_t len)
+{
+    struct bmi090l_api_stats *api_stats;
+
+    if ((dev != NULL) && (dev->stats != NULL))
+    {
+        api_stats = &dev->stats->api[dev->stats->cur_api];
+
+        if (dir == BMI090L_XFER_READ)
+        {
+            api_stats->read_txns++;
+            api_stats->read_bytes += len;
+        }
+        else
+        {
+            api_stats->write_txns++;
+            api_stats->write_bytes += len;
+        }
+    }
+}
+
+/*!
+ * @brief This internal API counts a vectored bus transaction against the
+ * current API.
+ */
+void bmi090l_stats_xfer(struct bmi090l_dev *dev, const struct bmi090l_xfer_seg *seg, uint8_t count)
+{
+    struct bmi090l_api_stats *api_stats;
+    uint8_t indx;
+
+    if ((dev != NULL) && (dev->stats != NULL))
+    {
+        api_stats = &dev->stats->api[dev->stats->cur_api];
+        api_stats->xfer_txns++;
+
+        for (indx = 0; indx < count; indx++)
+        {
+            if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                api_stats->read_bytes += seg[indx].len;
+            }
+            else
+            {
+                api_stats->write_bytes += seg[indx].len;
+            }
+        }
+    }
+}
+#endif
+
+/*****************************************************************************/
+/* Static function definition */
+
+/*! @cond DOXYGEN_SUPRESS */
+
+/* Suppressing doxygen warnings triggered for same static function names present across various sensor variant
+ * directories */
+
+/*!
+ * @brief This API is used to validate the device structure pointer for
+ * null conditions.
+ */
+static int8_t null_ptr_check(const struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL) ||
+        (dev->intf_ptr_accel == NULL) || (dev->intf_ptr_gyro == NULL))
+    {
+        /* Device structure pointer is not valid */
+        rslt = BMI090L_E_NULL_PTR;
+    }
+    else
+    {
+        /* Device structure is fine */
+        rslt = BMI090L_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address.
+ */
+static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint32_t indx;
+    uint8_t dummy_len = get_dummy_len(dev);
+
+    if (dummy_len == 0)
+    {
+        /* No dummy byte to strip, read directly into the caller's buffer */
+        rslt = get_regs_in_place(reg_addr, reg_data, len, dev);
+    }
+    else
+    {
+        uint8_t temp_buff[len + dummy_len];
+
+        rslt = get_regs_in_place(reg_addr, temp_buff, len, dev);
+        if (rslt == BMI090L_OK)
+        {
+            for (indx = 0; indx < len; indx++)
+            {
+                /* Updating the data buffer */
+                reg_data[indx] = temp_buff[indx + dummy_len];
+            }
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address, keeping
+ * the dummy byte at the start of the buffer.
+ */
+static int8_t get_regs_in_place(uint8_t reg_addr, uint8_t *buff, uint32_t len, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t dummy_len = get_dummy_len(dev);
+    uint8_t addr = reg_addr;
+
+    /* Configuration registers are answered from the shadow cache when known */
+    if (!shadow_get(reg_addr, &buff[dummy_len], len, dev))
+    {
+        if (dev->intf == BMI090L_SPI_INTF)
+        {
+            /* Configuring reg_addr for SPI Interface */
+            addr = reg_addr | BMI090L_SPI_RD_MASK;
+        }
+
+        /* Read the data from the register */
+        BMI090L_STATS_BUS(dev, BMI090L_XFER_READ, len + dummy_len);
+        dev->intf_rslt = dev->read(addr, buff, len + dummy_len, dev->intf_ptr_accel);
+
+        if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+        {
+            shadow_store(reg_addr, &buff[dummy_len], len, BMI090L_XFER_READ, dev);
+        }
+        else
+        {
+            /* Failure case */
+            rslt = BMI090L_E_COM_FAIL;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API returns the accel FIFO enable bit, reading the register
+ * only when the cached value is unknown.
+ */
+static int8_t get_fifo_accel_en(uint8_t *accel_en, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t config_data = 0;
+
+    if (dev->accel_fifo_en == BMI090L_FIFO_EN_UNKNOWN)
+    {
+        /* Get the set FIFO frame configurations */
+        rslt = get_regs(BMI090L_FIFO_CONFIG_1_ADDR, &config_data, 1, dev);
+        if (rslt == BMI090L_OK)
+        {
+            dev->accel_fifo_en = config_data & BMI090L_ACCEL_EN_MASK;
+        }
+    }
+
+    *accel_en = dev->accel_fifo_en;
+
+    return rslt;
+}
+
+/*!
+ * @brief This API returns the number of dummy bytes returned by the read
+ * callback.
+ */
+static uint8_t get_dummy_len(const struct bmi090l_dev *dev)
+{
+    uint8_t dummy_len = dev->dummy_byte;
+
+    if (dev->dummy_byte_mode == BMI090L_DUMMY_BYTE_INTF)
+    {
+        /* Dummy byte is discarded by the interface */
+        dummy_len = 0;
+    }
+
+    return dummy_len;
+}
+
+/*!
+ * @brief This API writes the data to the given register address.
+ */
+static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t addr = reg_addr;
+
+    if (dev->intf == BMI090L_SPI_INTF)
+    {
+        /* Configuring reg_addr for SPI Interface */
+        addr = (reg_addr & BMI090L_SPI_WR_MASK);
+    }
+
+    /* Write to an accel register */
+    BMI090L_STATS_BUS(dev, BMI090L_XFER_WRITE, len);
+    dev->intf_rslt = dev->write(addr, reg_data, len, dev->intf_ptr_accel);
+
+    if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+    {
+        shadow_store(reg_addr, reg_data, len, BMI090L_XFER_WRITE, dev);
+    }
+    else
+    {
+        /* Register state is unknown, drop the shadow cache */
+        dev->shadow.accel_valid = 0;
 
-        rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t*) feature_config, sizeof(feature_config), dev);
+        /* Updating the error status */
+        rslt = BMI090L_E_COM_FAIL;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets low-g configurations like threshold,
- * hysteresis and duration
+ * @brief This API configures the pins which fire the
+ * interrupt signal when any interrupt occurs.
  */
-int8_t bmi090la_get_low_g_config(struct bmi090l_low_g_cfg *config, struct bmi090l_dev *dev)
+static int8_t set_int_pin_config(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t reg_addr = 0, data, is_channel_invalid = FALSE;
 
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_LOW_G_START_ADR + 3] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
-
-    if (rslt == BMI090L_OK)
+    switch (int_config->int_channel)
     {
-        /* Define the offset in bytes for low-g select */
-        uint8_t idx = BMI090L_LOW_G_START_ADR;
+        case BMI090L_INT_CHANNEL_1:
 
-        /* Get threshold */
-        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[idx], BMI090L_LOW_G_THRES);
+            /* Update reg_addr based on channel inputs */
+            reg_addr = BMI090L_REG_ACCEL_INT1_IO_CONF;
+            break;
+        case BMI090L_INT_CHANNEL_2:
 
-        /* Get hysteresis */
-        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[idx + 1], BMI090L_LOW_G_HYST);
+            /* Update reg_addr based on channel inputs */
+            reg_addr = BMI090L_REG_ACCEL_INT2_IO_CONF;
+            break;
+        default:
+            is_channel_invalid = TRUE;
+            break;
+    }
 
-        /* Get high-g enable */
-        config->enable = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_LOW_G_ENABLE);
+    if (!is_channel_invalid)
+    {
+        /* Read interrupt pin configuration register */
+        rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
 
-        /* Get duration */
-        config->duration = BMI090L_GET_BITS_POS_0(feature_config[idx + 2], BMI090L_LOW_G_DUR);
+        if (rslt == BMI090L_OK)
+        {
+            /* Update data with user configured bmi090l_int_cfg structure */
+            data = get_int_pin_conf(int_config, data);
 
+            /* Write to interrupt pin configuration register */
+            rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_INVALID_INPUT;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta and hysteresis
- *
+ * @brief This API updates an interrupt pin configuration register value with
+ * the user settings.
  */
-int8_t bmi090la_set_orient_config(const struct bmi090l_orient_cfg *config, struct bmi090l_dev *dev)
+static uint8_t get_int_pin_conf(const struct bmi090l_accel_int_channel_cfg *int_config, uint8_t data)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_ORIENT_START_ADR + 2] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+    /* Update data with user configured bmi090l_int_cfg structure */
+    data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_LVL, int_config->int_pin_cfg.lvl);
+    data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_OD, int_config->int_pin_cfg.output_mode);
 
-    if (rslt == BMI090L_OK)
+    if (int_config->int_type == BMI090L_ACCEL_SYNC_INPUT)
     {
-        /* Define the offset in bytes for orient select */
-        uint8_t idx = BMI090L_ORIENT_START_ADR;
-
-        /* Set orientation feature - enabled/disabled */
-        feature_config[idx] = BMI090L_SET_BITS_POS_0(feature_config[idx], BMI090L_ORIENT_ENABLE, config->enable);
-
-        /* Set upside/down detection */
-        feature_config[idx] = BMI090L_SET_BITS(feature_config[idx], BMI090L_ORIENT_UP_DOWN, config->ud_en);
-
-        /* Set symmetrical modes */
-        feature_config[idx] = BMI090L_SET_BITS(feature_config[idx], BMI090L_ORIENT_SYMM_MODE, config->mode);
-
-        /* Set blocking mode */
-        feature_config[idx] = BMI090L_SET_BITS(feature_config[idx], BMI090L_ORIENT_BLOCK_MODE, config->blocking);
-
-        /* Set theta */
-        feature_config[idx] = BMI090L_SET_BITS(feature_config[idx], BMI090L_ORIENT_THETA, config->theta);
-
-        /* Set hysteresis */
-        feature_config[idx + 1] = BMI090L_SET_BITS_POS_0(feature_config[idx + 1],
-                                                         BMI090L_ORIENT_HYST,
-                                                         config->hysteresis);
-
-        rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
-
+        data = BMI090L_SET_BITS_POS_0(data, BMI090L_ACCEL_INT_EDGE, BMI090L_ENABLE);
+        data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_IN, int_config->int_pin_cfg.enable_int_pin);
+        data = BMI090L_SET_BIT_VAL_0(data, BMI090L_ACCEL_INT_IO);
+    }
+    else
+    {
+        data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_IO, int_config->int_pin_cfg.enable_int_pin);
+        data = BMI090L_SET_BIT_VAL_0(data, BMI090L_ACCEL_INT_IN);
     }
 
-    return rslt;
+    return data;
 }
 
 /*!
- * @brief This API sets orientation configurations like upside/down
- * detection, symmetrical modes, blocking mode, theta, hysteresis and output
- * configuration.
+ * @brief This API maps or unmaps an interrupt and configures the interrupt
+ * pin, reading and writing both registers in one batch each.
  */
-int8_t bmi090la_get_orient_config(struct bmi090l_orient_cfg *config, struct bmi090l_dev *dev)
+static int8_t set_int_map(const struct bmi090l_accel_int_channel_cfg *int_config,
+                          uint8_t map_addr,
+                          uint8_t map_mask,
+                          uint8_t enable,
+                          struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t data[2] = { 0 };
+    struct bmi090l_xfer_seg seg[2];
 
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_ORIENT_START_ADR + 2] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
-
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
     if (rslt == BMI090L_OK)
     {
-        /* Define the offset in bytes for orient select */
-        uint8_t idx = BMI090L_ORIENT_START_ADR;
+        switch (int_config->int_channel)
+        {
+            case BMI090L_INT_CHANNEL_1:
+                seg[0].reg_addr = BMI090L_REG_ACCEL_INT1_IO_CONF;
+                break;
 
-        /* Get orientation feature - enabled/disabled */
-        config->enable = BMI090L_GET_BITS_POS_0(feature_config[idx], BMI090L_ORIENT_ENABLE);
+            case BMI090L_INT_CHANNEL_2:
+                seg[0].reg_addr = BMI090L_REG_ACCEL_INT2_IO_CONF;
+                break;
 
-        /* Get upside/down detection */
-        config->ud_en = BMI090L_GET_BITS(feature_config[idx], BMI090L_ORIENT_UP_DOWN);
+            default:
+                rslt = BMI090L_E_INVALID_INPUT;
+                break;
+        }
+    }
 
-        /* Get symmetrical modes */
-        config->mode = BMI090L_GET_BITS(feature_config[idx], BMI090L_ORIENT_SYMM_MODE);
+    if (rslt == BMI090L_OK)
+    {
+        seg[0].dir = BMI090L_XFER_READ;
+        seg[0].data = &data[0];
+        seg[0].len = 1;
+        seg[1].reg_addr = map_addr;
+        seg[1].dir = BMI090L_XFER_READ;
+        seg[1].data = &data[1];
+        seg[1].len = 1;
+
+        /* Read interrupt pin configuration and map registers */
+        rslt = xfer_regs(seg, 2, dev);
+    }
 
-        /* Get blocking mode */
-        config->blocking = BMI090L_GET_BITS(feature_config[idx], BMI090L_ORIENT_BLOCK_MODE);
+    if (rslt == BMI090L_OK)
+    {
+        data[0] = get_int_pin_conf(int_config, data[0]);
 
-        /* Get theta */
-        config->theta = BMI090L_GET_BITS(feature_config[idx], BMI090L_ORIENT_THETA);
+        if (enable)
+        {
+            data[1] |= map_mask;
+        }
+        else
+        {
+            data[1] &= (uint8_t)~map_mask;
+        }
 
-        /* Get hysteresis */
-        config->hysteresis = BMI090L_GET_BITS_POS_0(feature_config[idx + 1], BMI090L_ORIENT_HYST);
+        /* Configure the pin before the interrupt is routed to it */
+        seg[0].dir = BMI090L_XFER_WRITE;
+        seg[1].dir = BMI090L_XFER_WRITE;
+        rslt = xfer_regs(seg, 2, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This internal API sets no-motion configurations like axes select,
- * duration, threshold and output-configuration.
+ * @brief This API maps or unmaps a feature interrupt on INT1 or INT2.
  */
-int8_t bmi090la_set_no_motion_config(const struct bmi090l_no_motion_cfg *config, struct bmi090l_dev *dev)
+static int8_t set_feature_int_map(const struct bmi090l_accel_int_channel_cfg *int_config,
+                                  uint8_t map_mask,
+                                  struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
+    int8_t rslt = BMI090L_OK;
+    uint8_t reg_addr = 0;
 
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_NO_MOTION_START_ADR + 2] = { 0 };
+    switch (int_config->int_channel)
+    {
+        case BMI090L_INT_CHANNEL_1:
+            reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
+            break;
+
+        case BMI090L_INT_CHANNEL_2:
+            reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
+            break;
 
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+        default:
+            rslt = BMI090L_E_INVALID_INPUT;
+            break;
+    }
 
     if (rslt == BMI090L_OK)
     {
-        /* Define the offset in bytes for orient select */
-        uint8_t idx = BMI090L_NO_MOTION_START_ADR;
-
-        feature_config[idx] =
-            BMI090L_SET_BITS_POS_0(feature_config[idx], BMI090L_NO_MOTION_THRESHOLD, config->threshold);
-
-        feature_config[idx] = BMI090L_SET_BITS(feature_config[idx], BMI090L_NO_MOTION_SEL, config->enable);
+        rslt = set_int_map(int_config,
+                           reg_addr,
+                           map_mask,
+                           (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE),
+                           dev);
+    }
 
-        feature_config[idx + 1] = BMI090L_SET_BITS_POS_0(feature_config[idx + 1],
-                                                         BMI090L_NO_MOTION_DURATION,
-                                                         config->duration);
+    return rslt;
+}
 
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_X_EN, config->select_x);
+/*!
+ * @brief This API performs a list of register transactions, answering leading
+ * reads from the shadow cache.
+ */
+static int8_t xfer_regs(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    struct bmi090l_xfer_seg pending[BMI090L_XFER_MAX_SEGS];
+    uint8_t pending_count = 0;
+    uint8_t write_seen = FALSE;
+    uint8_t indx;
 
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_Y_EN, config->select_y);
+    if (dev->shadow.enable && (count <= BMI090L_XFER_MAX_SEGS))
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            /* Reads behind a write of the same batch must see the sensor */
+            if (seg[indx].dir == BMI090L_XFER_WRITE)
+            {
+                write_seen = TRUE;
+            }
 
-        feature_config[idx + 1] = BMI090L_SET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_Z_EN, config->select_z);
+            if (write_seen || !shadow_get(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev))
+            {
+                pending[pending_count++] = seg[indx];
+            }
+        }
 
-        rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+        if (pending_count > 0)
+        {
+            rslt = xfer_regs_bus(pending, pending_count, dev);
+        }
+    }
+    else
+    {
+        rslt = xfer_regs_bus(seg, count, dev);
     }
 
     return rslt;
 }
 
-int8_t bmi090la_get_no_motion_config(struct bmi090l_no_motion_cfg *config, struct bmi090l_dev *dev)
+/*!
+ * @brief This API performs a list of register transactions, through the
+ * vectored interface when available.
+ */
+static int8_t xfer_regs_bus(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
-    int8_t rslt;
-
-    /* Array to define the feature configuration */
-    uint16_t feature_config[BMI090L_NO_MOTION_START_ADR + 2] = { 0 };
-
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+    int8_t rslt = BMI090L_OK;
+    struct bmi090l_xfer_seg wire[BMI090L_XFER_MAX_SEGS];
+    uint8_t stage[BMI090L_XFER_MAX_SEGS][BMI090L_XFER_STAGE_LEN + 1];
+    uint8_t dummy_len = get_dummy_len(dev);
+    uint8_t use_xfer = ((dev->xfer != NULL) && (count > 0) && (count <= BMI090L_XFER_MAX_SEGS));
+    uint8_t indx;
+    uint32_t byte;
+
+    /* Reads with a dummy byte are staged, long ones are left to the plain path */
+    for (indx = 0; (indx < count) && use_xfer; indx++)
+    {
+        if ((seg[indx].dir == BMI090L_XFER_READ) && (dummy_len != 0) && (seg[indx].len > BMI090L_XFER_STAGE_LEN))
+        {
+            use_xfer = FALSE;
+        }
+    }
 
-    if (rslt == BMI090L_OK)
+    if (use_xfer)
     {
-        /* Define the offset in bytes for orient select */
-        uint8_t idx = BMI090L_NO_MOTION_START_ADR;
+        for (indx = 0; indx < count; indx++)
+        {
+            wire[indx] = seg[indx];
 
-        config->threshold = BMI090L_GET_BITS_POS_0(feature_config[idx], BMI090L_NO_MOTION_THRESHOLD);
+            if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                if (dev->intf == BMI090L_SPI_INTF)
+                {
+                    /* Configuring reg_addr for SPI Interface */
+                    wire[indx].reg_addr = seg[indx].reg_addr | BMI090L_SPI_RD_MASK;
+                }
 
-        config->enable = BMI090L_GET_BITS(feature_config[idx], BMI090L_NO_MOTION_SEL);
+                if (dummy_len != 0)
+                {
+                    wire[indx].data = stage[indx];
+                    wire[indx].len = seg[indx].len + dummy_len;
+                }
+            }
+            else if (dev->intf == BMI090L_SPI_INTF)
+            {
+                /* Configuring reg_addr for SPI Interface */
+                wire[indx].reg_addr = seg[indx].reg_addr & BMI090L_SPI_WR_MASK;
+            }
+        }
 
-        config->duration = BMI090L_GET_BITS_POS_0(feature_config[idx + 1], BMI090L_NO_MOTION_DURATION);
+        BMI090L_STATS_XFER(dev, wire, count);
 
-        config->select_x = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_X_EN);
+        dev->intf_rslt = dev->xfer(wire, count, dev->intf_ptr_accel);
 
-        config->select_y = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_Y_EN);
+        if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+        {
+            for (indx = 0; indx < count; indx++)
+            {
+                if ((seg[indx].dir == BMI090L_XFER_READ) && (dummy_len != 0))
+                {
+                    for (byte = 0; byte < seg[indx].len; byte++)
+                    {
+                        seg[indx].data[byte] = stage[indx][byte + dummy_len];
+                    }
+                }
 
-        config->select_z = BMI090L_GET_BITS(feature_config[idx + 1], BMI090L_NO_MOTION_Z_EN);
+                shadow_store(seg[indx].reg_addr, seg[indx].data, seg[indx].len, seg[indx].dir, dev);
+            }
+        }
+        else
+        {
+            /* Register state is unknown, drop the shadow cache */
+            dev->shadow.accel_valid = 0;
 
+            /* Failure case */
+            rslt = BMI090L_E_COM_FAIL;
+        }
+    }
+    else
+    {
+        for (indx = 0; (indx < count) && (rslt == BMI090L_OK); indx++)
+        {
+            if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                rslt = get_regs(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev);
+            }
+            else
+            {
+                rslt = set_regs(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev);
+            }
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the output values of orientation: portrait-
- * landscape and face up-down.
+ * @brief This API returns the shadow cache index of a register.
  */
-int8_t bmi090la_get_orient_output(struct bmi090l_orient_out *orient_out, struct bmi090l_dev *dev)
+static uint8_t shadow_index(uint8_t reg_addr)
 {
-    int8_t rslt;
-    uint8_t data;
+    static const uint8_t shadow_reg[BMI090L_SHADOW_ACCEL_LEN] = {
+        BMI090L_REG_ACCEL_CONF, BMI090L_REG_ACCEL_RANGE, BMI090L_FIFO_DOWNS_ADDR, BMI090L_FIFO_WTM_0_ADDR,
+        BMI090L_FIFO_WTM_1_ADDR, BMI090L_FIFO_CONFIG_0_ADDR, BMI090L_FIFO_CONFIG_1_ADDR,
+        BMI090L_REG_ACCEL_INT1_IO_CONF, BMI090L_REG_ACCEL_INT2_IO_CONF, BMI090L_REG_ACCEL_INT_LATCH_CONF,
+        BMI090L_REG_ACCEL_INT1_MAP, BMI090L_REG_ACCEL_INT2_MAP, BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA,
+        BMI090L_REG_ACCEL_PWR_CONF, BMI090L_REG_ACCEL_PWR_CTRL
+    };
+    uint8_t indx = 0;
 
-    /* Search for orientation output feature and extract its configuration details */
-    rslt = bmi090la_get_regs(BMI090L_REG_ORIENT_HIGHG_OUT, &data, 1, dev);
-    if (rslt == BMI090L_OK)
+    while ((indx < BMI090L_SHADOW_ACCEL_LEN) && (shadow_reg[indx] != reg_addr))
     {
-        orient_out->portrait_landscape = BMI090L_GET_BITS_POS_0(data, BMI090L_ORIENT_PORTRAIT_LANDSCAPE);
-        orient_out->faceup_down = BMI090L_GET_BITS(data, BMI090L_ORIENT_FACEUP_DOWN);
+        indx++;
     }
 
-    return rslt;
+    return indx;
 }
 
 /*!
- * @brief This API gets the output values of high_g: Axis and Direction
+ * @brief This API answers a register read from the shadow cache.
  */
-int8_t bmi090la_get_high_g_output(struct bmi090l_high_g_out *high_g_out, struct bmi090l_dev *dev)
+static uint8_t shadow_get(uint8_t reg_addr, uint8_t *data, uint32_t len, const struct bmi090l_dev *dev)
 {
-    int8_t rslt;
-    uint8_t data;
+    uint8_t hit = FALSE;
+    uint8_t indx[BMI090L_SHADOW_ACCEL_LEN];
+    uint32_t byte;
 
-    /* Search for high-g output feature and extract its configuration details */
-    rslt = bmi090la_get_regs(BMI090L_REG_ORIENT_HIGHG_OUT, &data, 1, dev);
-    if (rslt == BMI090L_OK)
+    if (dev->shadow.enable && (len > 0) && (len <= BMI090L_SHADOW_ACCEL_LEN))
     {
-        high_g_out->x = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_X);
-        high_g_out->y = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_Y);
-        high_g_out->z = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_Z);
-        high_g_out->direction = BMI090L_GET_BITS(data, BMI090L_HIGH_G_AXIS_DIRECTION);
+        hit = TRUE;
+        for (byte = 0; (byte < len) && hit; byte++)
+        {
+            indx[byte] = shadow_index((uint8_t)(reg_addr + byte));
+            hit = ((indx[byte] < BMI090L_SHADOW_ACCEL_LEN) && (dev->shadow.accel_valid & (1u << indx[byte])));
+        }
+
+        for (byte = 0; (byte < len) && hit; byte++)
+        {
+            data[byte] = dev->shadow.accel[indx[byte]];
+        }
     }
 
-    return rslt;
+    return hit;
 }
 
 /*!
- * @brief This internal API gets accel feature interrupt status
+ * @brief This API updates the shadow cache after a successful register read
+ * or write.
  */
-int8_t bmi090la_get_feat_int_status(uint8_t *int_status, struct bmi090l_dev *dev)
+static void shadow_store(uint8_t reg_addr, const uint8_t *data, uint32_t len, uint8_t dir, struct bmi090l_dev *dev)
 {
-    int8_t rslt;
-    uint8_t status = 0;
+    uint8_t indx;
+    uint32_t byte;
 
-    if (int_status != NULL)
+    if (dev->shadow.enable)
     {
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT_STAT_0, &status, 1, dev);
-        if (rslt == BMI090L_OK)
+        if ((dir == BMI090L_XFER_WRITE) && (reg_addr == BMI090L_REG_ACCEL_SOFTRESET) &&
+            (data[0] == BMI090L_SOFT_RESET_CMD))
         {
-            (*int_status) = status;
+            dev->shadow.accel_valid = 0;
+        }
+        else if ((reg_addr == BMI090L_FIFO_DATA_ADDR) || (reg_addr == BMI090L_REG_ACCEL_FEATURE_CFG))
+        {
+            /* Burst access to these stays on the same address */
+        }
+        else if (len <= BMI090L_SHADOW_ACCEL_LEN)
+        {
+            for (byte = 0; byte < len; byte++)
+            {
+                indx = shadow_index((uint8_t)(reg_addr + byte));
+                if (indx < BMI090L_SHADOW_ACCEL_LEN)
+                {
+                    dev->shadow.accel[indx] = data[byte];
+                    dev->shadow.accel_valid |= (uint16_t)(1u << indx);
+                }
+            }
+        }
+        else if (dir == BMI090L_XFER_WRITE)
+        {
+            /* Long writes are not tracked */
+            dev->shadow.accel_valid = 0;
         }
     }
-    else
+}
+
+/*!
+ * @brief This API reads all cached registers into the shadow cache.
+ */
+static int8_t shadow_fill(struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t data[BMI090L_SHADOW_ACCEL_LEN];
+    struct bmi090l_xfer_seg seg[4];
+
+    if (dev->shadow.enable)
     {
-        rslt = BMI090L_E_NULL_PTR;
+        dev->shadow.accel_valid = 0;
+
+        seg[0].reg_addr = BMI090L_REG_ACCEL_CONF;
+        seg[0].data = &data[0];
+        seg[0].len = 2;
+        seg[1].reg_addr = BMI090L_FIFO_DOWNS_ADDR;
+        seg[1].data = &data[2];
+        seg[1].len = 5;
+        seg[2].reg_addr = BMI090L_REG_ACCEL_INT1_IO_CONF;
+        seg[2].data = &data[7];
+        seg[2].len = 6;
+        seg[3].reg_addr = BMI090L_REG_ACCEL_PWR_CONF;
+        seg[3].data = &data[13];
+        seg[3].len = 2;
+        seg[0].dir = seg[1].dir = seg[2].dir = seg[3].dir = BMI090L_XFER_READ;
+
+        /* The reads update the cache */
+        rslt = xfer_regs(seg, 4, dev);
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API gets the re-mapped x, y and z axes from the sensor and
- * updates the values in the device structure.
+ * @brief This API loads the feature configuration space into the RAM image.
  */
-int8_t bmi090la_get_remap_axes(struct bmi090l_remap *remapped_axis, struct bmi090l_dev *dev)
+static int8_t feature_load(struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t data[BMI090L_FEATURE_SIZE];
+    uint8_t indx;
 
-    /* Null-pointer check */
+    /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
-    if ((rslt == BMI090L_OK) && (remapped_axis != NULL))
+
+    if ((rslt == BMI090L_OK) && !dev->feature.valid)
     {
-        /* Get the re-mapped axes from the sensor */
-        rslt = get_remap_axes(&dev->remap, dev);
+        rslt = get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, data, BMI090L_FEATURE_SIZE, dev);
+
         if (rslt == BMI090L_OK)
         {
-            /* Store the receive re-mapped axis and sign from device structure */
-            receive_remap_axis(dev->remap.x_axis, dev->remap.x_axis_sign, &remapped_axis->x);
-            receive_remap_axis(dev->remap.y_axis, dev->remap.y_axis_sign, &remapped_axis->y);
-            receive_remap_axis(dev->remap.z_axis, dev->remap.z_axis_sign, &remapped_axis->z);
+            for (indx = 0; indx < BMI090L_FEATURE_WORDS; indx++)
+            {
+                dev->feature.word[indx] = (uint16_t)(data[indx * 2] | ((uint16_t)data[(indx * 2) + 1] << 8));
+            }
+
+            dev->feature.dirty = 0;
+            dev->feature.valid = TRUE;
         }
     }
-    else
-    {
-        rslt = BMI090L_E_NULL_PTR;
-    }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the re-mapped x, y and z axes to the sensor and
- * updates the them in the device structure.
+ * @brief This API reads words of the feature configuration from the RAM image.
  */
-int8_t bmi090la_set_remap_axes(const struct bmi090l_remap *remapped_axis, struct bmi090l_dev *dev)
+static int8_t feature_get_words(uint8_t word, uint16_t *data, uint8_t len, struct bmi090l_dev *dev)
 {
-    /* Variable to define error */
     int8_t rslt;
+    uint8_t indx;
 
-    /* Variable to store all the re-mapped axes */
-    uint8_t remap_axes = 0;
+    rslt = feature_load(dev);
 
-    /* Null-pointer check */
-    rslt = null_ptr_check(dev);
-    if ((rslt == BMI090L_OK) && (remapped_axis != NULL))
+    if ((rslt == BMI090L_OK) && ((word + len) <= BMI090L_FEATURE_WORDS))
     {
-        /* Check whether all the axes are re-mapped */
-        remap_axes = remapped_axis->x | remapped_axis->y | remapped_axis->z;
-
-        /* If all the axes are re-mapped */
-        if ((remap_axes & BMI090L_AXIS_MASK) == BMI090L_AXIS_MASK)
-        {
-            /* Store the value of re-mapped in device structure */
-            assign_remap_axis(remapped_axis->x, &dev->remap.x_axis, &dev->remap.x_axis_sign);
-            assign_remap_axis(remapped_axis->y, &dev->remap.y_axis, &dev->remap.y_axis_sign);
-            assign_remap_axis(remapped_axis->z, &dev->remap.z_axis, &dev->remap.z_axis_sign);
-
-            /* Set the re-mapped axes in the sensor */
-            rslt = set_remap_axes(&dev->remap, dev);
-        }
-        else
+        for (indx = 0; indx < len; indx++)
         {
-            rslt = BMI090L_E_REMAP_ERROR;
+            data[indx] = dev->feature.word[word + indx];
         }
     }
-    else
+    else if (rslt == BMI090L_OK)
     {
-        rslt = BMI090L_E_NULL_PTR;
+        rslt = BMI090L_E_INVALID_INPUT;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API is used to get the config file major and minor information.
+ * @brief This API updates a word of the RAM image and marks it dirty.
  */
-int8_t bmi090la_get_version_config(uint16_t *config_major, uint16_t *config_minor, struct bmi090l_dev *dev)
+static void feature_set_word(uint8_t word, uint16_t value, struct bmi090l_dev *dev)
 {
-    /* Initialize configuration file */
-    uint8_t feature_config[BMI090L_FEATURE_SIZE] = { 0 };
-
-    /* Update index to config file version */
-    uint8_t index = BMI090L_ADDR_CONFIG_ID_START;
-
-    /* Variable to define LSB */
-    uint8_t lsb = 0;
-
-    /* Variable to define MSB */
-    uint8_t msb = 0;
-
-    /* Variable to define LSB and MSB */
-    uint16_t lsb_msb = 0;
+    if ((word != BMI090L_CONFIG_ID_WORD) && (dev->feature.word[word] != value))
+    {
+        dev->feature.word[word] = value;
+        dev->feature.dirty |= (uint16_t)(1u << word);
+    }
+}
 
-    /* Result of api are returned to this variable */
-    int8_t rslt;
+/*!
+ * @brief This API writes the dirty words of the RAM image to the sensor.
+ * Feature space writes always start at the first word, so the span written
+ * ends at the last dirty word.
+ */
+static int8_t feature_flush(struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t data[BMI090L_FEATURE_SIZE];
+    uint8_t len = 0;
+    uint8_t indx;
 
-    if ((config_major != NULL) && (config_minor != NULL))
+    for (indx = 0; indx < BMI090L_FEATURE_WORDS; indx++)
     {
-        /* Get config file identification from the sensor */
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, (uint8_t *)feature_config, sizeof(feature_config), dev);
+        if (dev->feature.dirty & (1u << indx))
+        {
+            len = indx + 1;
+        }
+    }
 
-        if (rslt == BMI090L_OK)
+    if (len > 0)
+    {
+        for (indx = 0; indx < len; indx++)
         {
-            /* Get word to calculate config file identification */
-            lsb = feature_config[index++];
-            msb = feature_config[index++];
+            data[indx * 2] = (uint8_t)(dev->feature.word[indx] & 0xFF);
+            data[(indx * 2) + 1] = (uint8_t)(dev->feature.word[indx] >> 8);
+        }
 
-            lsb_msb = (uint16_t)(msb << 8 | lsb);
+        rslt = set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, data, (uint32_t)len * 2, dev);
 
-            /* Get major and minor version */
-            *config_major = BMI090L_GET_BITSLICE(lsb_msb, BMI090L_CONFIG_MAJOR);
-            *config_minor = BMI090L_GET_BITS_POS_0(lsb, BMI090L_CONFIG_MINOR);
+        if (rslt == BMI090L_OK)
+        {
+            dev->feature.dirty = 0;
+        }
+        else
+        {
+            /* Feature space state is unknown, reload on next use */
+            dev->feature.valid = FALSE;
         }
-    }
-    else
-    {
-        rslt = BMI090L_E_NULL_PTR;
     }
 
     return rslt;
 }
 
-/*****************************************************************************/
-/* Static function definition */
-
-/*! @cond DOXYGEN_SUPRESS */
-
-/* Suppressing doxygen warnings triggered for same static function names present across various sensor variant
- * directories */
-
 /*!
- * @brief This API is used to validate the device structure pointer for
- * null conditions.
+ * @brief This API waits until a masked accel register reads the given value.
  */
-static int8_t null_ptr_check(const struct bmi090l_dev *dev)
+static void wait_ready(uint8_t reg_addr, uint8_t mask, uint8_t value, uint32_t timeout_us, struct bmi090l_dev *dev)
 {
-    int8_t rslt;
+    uint32_t waited = 0;
+    uint32_t backoff = BMI090L_POLL_BACKOFF_MIN_US;
+    uint8_t data = 0;
+    uint8_t ready = FALSE;
 
-    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL) ||
-        (dev->intf_ptr_accel == NULL) || (dev->intf_ptr_gyro == NULL))
+    if (dev->wait_mode != BMI090L_WAIT_POLL)
     {
-        /* Device structure pointer is not valid */
-        rslt = BMI090L_E_NULL_PTR;
+        dev->delay_us(timeout_us, dev->intf_ptr_accel);
     }
     else
     {
-        /* Device structure is fine */
-        rslt = BMI090L_OK;
-    }
+        while (!ready && (waited < timeout_us))
+        {
+            if (backoff > (timeout_us - waited))
+            {
+                backoff = timeout_us - waited;
+            }
 
-    return rslt;
+            dev->delay_us(backoff, dev->intf_ptr_accel);
+            waited += backoff;
+
+            /* A sensor still busy may not answer, keep polling until the timeout */
+            if ((get_regs(reg_addr, &data, 1, dev) == BMI090L_OK) && ((data & mask) == value))
+            {
+                ready = TRUE;
+            }
+
+            if (backoff < BMI090L_POLL_BACKOFF_MAX_US)
+            {
+                backoff *= 2;
+            }
+        }
+    }
 }
 
 /*!
- * @brief This API reads the data from the given register address.
+ * @brief This API waits for the sensor without blocking.
  */
-static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+static uint8_t init_wait(struct bmi090l_init_ctx *ctx,
+                         uint8_t reg_addr,
+                         uint8_t mask,
+                         uint8_t value,
+                         uint32_t timeout_us,
+                         uint32_t *wait_us,
+                         struct bmi090l_dev *dev)
 {
-    int8_t rslt = BMI090L_OK;
-    uint32_t indx;
-    uint32_t temp_len = len + dev->dummy_byte;
-    uint8_t temp_buff[temp_len];
+    uint32_t delay;
+    uint8_t data = 0;
+    uint8_t done = FALSE;
 
-    if (dev->intf == BMI090L_SPI_INTF)
+    if (ctx->backoff_us == 0)
     {
-        /* Configuring reg_addr for SPI Interface */
-        reg_addr = reg_addr | BMI090L_SPI_RD_MASK;
+        /* The action has just been issued */
+        ctx->waited_us = 0;
+    }
+    else if ((dev->wait_mode == BMI090L_WAIT_POLL) && (get_regs(reg_addr, &data, 1, dev) == BMI090L_OK) &&
+             ((data & mask) == value))
+    {
+        done = TRUE;
+    }
+    else if (ctx->waited_us >= timeout_us)
+    {
+        /* The caller checks the sensor state as after the fixed delay */
+        done = TRUE;
     }
 
-    /* Read the data from the register */
-    dev->intf_rslt = dev->read(reg_addr, temp_buff, temp_len, dev->intf_ptr_accel);
-
-    if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+    if (done)
     {
-        for (indx = 0; indx < len; indx++)
-        {
-            /* Updating the data buffer */
-            reg_data[indx] = temp_buff[indx + dev->dummy_byte];
-        }
+        ctx->backoff_us = 0;
+        *wait_us = 0;
     }
     else
     {
-        /* Failure case */
-        rslt = BMI090L_E_COM_FAIL;
+        if (dev->wait_mode != BMI090L_WAIT_POLL)
+        {
+            delay = timeout_us - ctx->waited_us;
+        }
+        else if (ctx->backoff_us == 0)
+        {
+            delay = BMI090L_POLL_BACKOFF_MIN_US;
+        }
+        else if (ctx->backoff_us < BMI090L_POLL_BACKOFF_MAX_US)
+        {
+            delay = ctx->backoff_us * 2;
+        }
+        else
+        {
+            delay = ctx->backoff_us;
+        }
+
+        if (delay > (timeout_us - ctx->waited_us))
+        {
+            delay = timeout_us - ctx->waited_us;
+        }
+
+        ctx->backoff_us = delay;
+        ctx->waited_us += delay;
+        *wait_us = delay;
     }
 
-    return rslt;
+    return done;
 }
 
 /*!
- * @brief This API writes the data to the given register address.
+ * @brief This API returns the first state of the next selected initialization step.
  */
-static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+static uint8_t init_next(uint8_t steps, uint8_t state)
 {
-    int8_t rslt = BMI090L_OK;
-
-    if (dev->intf == BMI090L_SPI_INTF)
+    if ((state == BMI090L_INIT_STATE_RESET) && !(steps & BMI090L_INIT_SOFT_RESET))
     {
-        /* Configuring reg_addr for SPI Interface */
-        reg_addr = (reg_addr & BMI090L_SPI_WR_MASK);
+        state = BMI090L_INIT_STATE_CONFIG;
     }
 
-    /* Write to an accel register */
-    dev->intf_rslt = dev->write(reg_addr, reg_data, len, dev->intf_ptr_accel);
+    if ((state == BMI090L_INIT_STATE_CONFIG) && !(steps & BMI090L_INIT_CONFIG_FILE))
+    {
+        state = BMI090L_INIT_STATE_POWER;
+    }
 
-    if (dev->intf_rslt != BMI090L_INTF_RET_SUCCESS)
+    if ((state == BMI090L_INIT_STATE_POWER) && !(steps & BMI090L_INIT_POWER_MODE))
     {
-        /* Updating the error status */
-        rslt = BMI090L_E_COM_FAIL;
+        state = BMI090L_INIT_STATE_DONE;
     }
 
-    return rslt;
+    return state;
 }
 
 /*!
- * @brief This API configures the pins which fire the
- * interrupt signal when any interrupt occurs.
+ * @brief This API returns the register values of the requested accel power mode.
  */
-static int8_t set_int_pin_config(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+static int8_t get_power_regs(uint8_t power_mode, uint8_t *data)
 {
-    int8_t rslt;
-    uint8_t reg_addr = 0, data, is_channel_invalid = FALSE;
+    int8_t rslt = BMI090L_OK;
 
-    switch (int_config->int_channel)
+    if (power_mode == BMI090L_ACCEL_PM_ACTIVE)
     {
-        case BMI090L_INT_CHANNEL_1:
-
-            /* Update reg_addr based on channel inputs */
-            reg_addr = BMI090L_REG_ACCEL_INT1_IO_CONF;
-            break;
-        case BMI090L_INT_CHANNEL_2:
-
-            /* Update reg_addr based on channel inputs */
-            reg_addr = BMI090L_REG_ACCEL_INT2_IO_CONF;
-            break;
-        default:
-            is_channel_invalid = TRUE;
-            break;
+        data[0] = BMI090L_ACCEL_PM_ACTIVE;
+        data[1] = BMI090L_ACCEL_POWER_ENABLE;
     }
-
-    if (!is_channel_invalid)
+    else if (power_mode == BMI090L_ACCEL_PM_SUSPEND)
     {
-        /* Read interrupt pin configuration register */
-        rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-        if (rslt == BMI090L_OK)
-        {
-            /* Update data with user configured bmi090l_int_cfg structure */
-            data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_LVL, int_config->int_pin_cfg.lvl);
-            data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_OD, int_config->int_pin_cfg.output_mode);
-
-            if (int_config->int_type == BMI090L_ACCEL_SYNC_INPUT)
-            {
-                data = BMI090L_SET_BITS_POS_0(data, BMI090L_ACCEL_INT_EDGE, BMI090L_ENABLE);
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_IN, int_config->int_pin_cfg.enable_int_pin);
-                data = BMI090L_SET_BIT_VAL_0(data, BMI090L_ACCEL_INT_IO);
-            }
-            else
-            {
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT_IO, int_config->int_pin_cfg.enable_int_pin);
-                data = BMI090L_SET_BIT_VAL_0(data, BMI090L_ACCEL_INT_IN);
-            }
-
-            /* Write to interrupt pin configuration register */
-            rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-        }
+        data[0] = BMI090L_ACCEL_PM_SUSPEND;
+        data[1] = BMI090L_ACCEL_POWER_DISABLE;
     }
     else
     {
+        /* Invalid power input */
         rslt = BMI090L_E_INVALID_INPUT;
     }
 
@@ -2749,104 +6154,47 @@ static int8_t set_int_pin_config(const struct bmi090l_accel_int_channel_cfg *int
  */
 static int8_t set_accel_data_ready_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
-    int8_t rslt;
-    uint8_t data = 0, conf;
-
-    /* Read interrupt map register */
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
+    int8_t rslt = BMI090L_OK;
+    uint8_t mask = 0;
 
-    if (rslt == BMI090L_OK)
+    switch (int_config->int_channel)
     {
-        conf = int_config->int_pin_cfg.enable_int_pin;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-
-                /* Updating the data */
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT1_DRDY, conf);
-                break;
-            case BMI090L_INT_CHANNEL_2:
-
-                /* Updating the data */
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT2_DRDY, conf);
-                break;
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
+        case BMI090L_INT_CHANNEL_1:
+            mask = BMI090L_ACCEL_INT1_DRDY_MASK;
+            break;
 
-        if (rslt == BMI090L_OK)
-        {
-            /* Configure interrupt pins */
-            rslt = set_int_pin_config(int_config, dev);
+        case BMI090L_INT_CHANNEL_2:
+            mask = BMI090L_ACCEL_INT2_DRDY_MASK;
+            break;
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
-            }
-        }
+        default:
+            rslt = BMI090L_E_INVALID_INPUT;
+            break;
     }
 
-    return rslt;
-}
-
-/*!
- * @brief This API sets the synchronized data ready interrupt for accel sensor
- */
-static int8_t set_accel_sync_data_ready_int(const struct bmi090l_accel_int_channel_cfg *int_config,
-                                            struct bmi090l_dev *dev)
-{
-    int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure */
-    rslt = null_ptr_check(dev);
     if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_DATA_SYNC_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
+    {
+        /* Update interrupt map and pin configuration */
+        rslt = set_int_map(int_config,
+                           BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA,
+                           mask,
+                           int_config->int_pin_cfg.enable_int_pin & BMI090L_ENABLE,
+                           dev);
+    }
 
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt A mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_DATA_SYNC_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_DATA_SYNC_INT_ENABLE;
-            }
+    return rslt;
+}
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
+/*!
+ * @brief This API sets the synchronized data ready interrupt for accel sensor
+ */
+static int8_t set_accel_sync_data_ready_int(const struct bmi090l_accel_int_channel_cfg *int_config,
+                                            struct bmi090l_dev *dev)
+{
+    int8_t rslt;
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* Interrupt A mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_DATA_SYNC_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -2875,56 +6223,9 @@ static int8_t set_accel_sync_input(const struct bmi090l_accel_int_channel_cfg *i
 static int8_t set_accel_anymotion_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure */
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_ANY_MOT_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_ANY_MOT_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_ANY_MOT_INT_ENABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* Interrupt B mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_ANY_MOT_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -2935,56 +6236,9 @@ static int8_t set_accel_anymotion_int(const struct bmi090l_accel_int_channel_cfg
 static int8_t set_accel_high_g_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure */
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_HIGH_G_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_HIGH_G_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_HIGH_G_INT_ENABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* High-g interrupt mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_HIGH_G_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -2995,56 +6249,9 @@ static int8_t set_accel_high_g_int(const struct bmi090l_accel_int_channel_cfg *i
 static int8_t set_accel_low_g_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
 
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_LOW_G_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_LOW_G_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_LOW_G_INT_DISABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* Low-g interrupt mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_LOW_G_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -3055,56 +6262,9 @@ static int8_t set_accel_low_g_int(const struct bmi090l_accel_int_channel_cfg *in
 static int8_t set_accel_orient_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure */
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_ORIENT_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_ORIENT_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_ORIENT_INT_ENABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* Orientation interrupt mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_ORIENT_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -3115,56 +6275,9 @@ static int8_t set_accel_orient_int(const struct bmi090l_accel_int_channel_cfg *i
 static int8_t set_accel_no_motion_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_NO_MOT_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_NO_MOT_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_NO_MOT_INT_ENABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* No-motion interrupt mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_NO_MOT_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -3175,56 +6288,9 @@ static int8_t set_accel_no_motion_int(const struct bmi090l_accel_int_channel_cfg
 static int8_t set_accel_err_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data, reg_addr = 0;
-
-    /* Check for null pointer in the device structure*/
-    rslt = null_ptr_check(dev);
-    if (rslt == BMI090L_OK)
-    {
-        data = BMI090L_ACCEL_ERR_INT_DISABLE;
-
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
-                reg_addr = BMI090L_REG_ACCEL_INT1_MAP;
-                break;
-
-            case BMI090L_INT_CHANNEL_2:
-                reg_addr = BMI090L_REG_ACCEL_INT2_MAP;
-                break;
-
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
-        }
-
-        if (rslt == BMI090L_OK)
-        {
-            rslt = bmi090la_get_regs(reg_addr, &data, 1, dev);
-
-            if (int_config->int_pin_cfg.enable_int_pin == BMI090L_ENABLE)
-            {
-                /* Interrupt B mapped to INT1/INT2 */
-                data |= BMI090L_ACCEL_ERR_INT_ENABLE;
-            }
-            else
-            {
-                data &= ~BMI090L_ACCEL_ERR_INT_ENABLE;
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(reg_addr, &data, 1, dev);
-            }
 
-            if (rslt == BMI090L_OK)
-            {
-                /* Set input interrupt configuration */
-                rslt = set_int_pin_config(int_config, dev);
-            }
-        }
-    }
+    /* Error interrupt mapped to INT1/INT2 */
+    rslt = set_feature_int_map(int_config, BMI090L_ACCEL_ERR_INT_ENABLE, dev);
 
     return rslt;
 }
@@ -3444,26 +6510,18 @@ static void unpack_accel_data(struct bmi090l_sensor_data *acc,
                               uint16_t data_start_indx,
                               const struct bmi090l_fifo_frame *fifo)
 {
-    /* Variables to store LSB value */
-    uint16_t data_lsb;
-
-    /* Variables to store MSB value */
-    uint16_t data_msb;
-
-    /* Accelerometer raw x data */
-    data_lsb = fifo->data[data_start_indx++];
-    data_msb = fifo->data[data_start_indx++];
-    acc->x = (int16_t)((data_msb << 8) | data_lsb);
-
-    /* Accelerometer raw y data */
-    data_lsb = fifo->data[data_start_indx++];
-    data_msb = fifo->data[data_start_indx++];
-    acc->y = (int16_t)((data_msb << 8) | data_lsb);
+    decode_accel_xyz(acc, &fifo->data[data_start_indx]);
+}
 
-    /* Accelerometer raw z data */
-    data_lsb = fifo->data[data_start_indx++];
-    data_msb = fifo->data[data_start_indx++];
-    acc->z = (int16_t)((data_msb << 8) | data_lsb);
+/*!
+ * @brief This internal API decodes the x, y and z data of an accel FIFO
+ * frame.
+ */
+static inline void decode_accel_xyz(struct bmi090l_sensor_data *acc, const uint8_t *data)
+{
+    acc->x = (int16_t)((uint16_t)(data[1] << 8) | data[0]);
+    acc->y = (int16_t)((uint16_t)(data[3] << 8) | data[2]);
+    acc->z = (int16_t)((uint16_t)(data[5] << 8) | data[4]);
 }
 
 /*!
@@ -3486,7 +6544,7 @@ static int8_t unpack_accel_frame(struct bmi090l_sensor_data *acc,
         case BMI090L_FIFO_HEADER_ACC_FRM:
 
             /* Partially read, then skip the data */
-            if (((*idx) + fifo->acc_frm_len) > fifo->length)
+            if (((*idx) + BMI090L_FIFO_ACCEL_LENGTH) > fifo->length)
             {
                 /* Update the data indx as complete */
                 (*idx) = fifo->length;
@@ -3610,8 +6668,19 @@ static int8_t extract_acc_header_mode(struct bmi090l_sensor_data *acc,
     /* Variable to indicate accelerometer frames read */
     uint16_t frame_to_read = *accel_length;
 
-    for (data_indx = fifo->acc_byte_start_idx; data_indx < fifo->length;)
-    {
+    for (data_indx = fifo->acc_byte_start_idx; data_indx < fifo->length;)
+    {
+        /* Runs of accel-only frames bypass the per-frame header switch */
+        if (fifo->data[data_indx] == BMI090L_FIFO_HEADER_ACC_FRM)
+        {
+            unpack_accel_run(acc, &data_indx, &accel_indx, frame_to_read, fifo);
+
+            if ((frame_to_read == accel_indx) || (data_indx >= fifo->length))
+            {
+                break;
+            }
+        }
+
         /* Get frame header byte */
         frame_header = fifo->data[data_indx];
 
@@ -3683,100 +6752,442 @@ static int8_t extract_acc_header_mode(struct bmi090l_sensor_data *acc,
 }
 
 /*!
- * @brief This API sets the FIFO water mark interrupt for accel sensor.
+ * @brief This internal API parses a run of accel-only frames from the FIFO
+ * data.
  */
-static int8_t set_accel_fifo_wm_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+static void unpack_accel_run(struct bmi090l_sensor_data *acc,
+                             uint16_t *idx,
+                             uint16_t *acc_idx,
+                             uint16_t acc_len,
+                             const struct bmi090l_fifo_frame *fifo)
 {
-    int8_t rslt;
-    uint8_t data = 0, conf;
+    const uint8_t frame_len = 1 + BMI090L_FIFO_ACCEL_LENGTH;
+    const uint8_t *frame = &fifo->data[*idx];
+    uint16_t data_indx = *idx;
+    uint16_t accel_indx = *acc_idx;
+
+    while ((accel_indx < acc_len) && ((fifo->length - data_indx) >= frame_len) &&
+           (frame[0] == BMI090L_FIFO_HEADER_ACC_FRM))
+    {
+        decode_accel_xyz(&acc[accel_indx], &frame[1]);
+        accel_indx++;
+        frame += frame_len;
+        data_indx += frame_len;
+    }
 
-    /* Read interrupt map register */
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
+    *idx = data_indx;
+    *acc_idx = accel_indx;
+}
 
-    if (rslt == BMI090L_OK)
+/*!
+ * @brief This internal API returns the length of an accel FIFO frame.
+ */
+static uint8_t get_fifo_frame_len(uint8_t header)
+{
+    uint8_t frame_len;
+
+    switch (header)
     {
-        conf = int_config->int_pin_cfg.enable_int_pin;
+        case BMI090L_FIFO_HEADER_ACC_FRM:
+        case BMI090L_FIFO_HEADER_ALL_FRM:
+            frame_len = 1 + BMI090L_FIFO_ACCEL_LENGTH;
+            break;
 
-        switch (int_config->int_channel)
+        case BMI090L_FIFO_HEADER_SENS_TIME_FRM:
+            frame_len = 1 + BMI090L_SENSOR_TIME_LENGTH;
+            break;
+
+        case BMI090L_FIFO_HEADER_SKIP_FRM:
+            frame_len = 1 + BMI090L_FIFO_SKIP_FRM_LENGTH;
+            break;
+
+        case BMI090L_FIFO_HEADER_INPUT_CFG_FRM:
+        case BMI090L_FIFO_SAMPLE_DROP_FRM:
+            frame_len = 1 + BMI090L_FIFO_INPUT_CFG_LENGTH;
+            break;
+
+        /* Over-read marker or invalid header */
+        default:
+            frame_len = 0;
+            break;
+    }
+
+    return frame_len;
+}
+
+/*!
+ * @brief This internal API parses one complete accel FIFO frame for the
+ * streaming parser.
+ */
+static void parse_fifo_frame(struct bmi090l_fifo_parser *parser,
+                             const uint8_t *frame,
+                             struct bmi090l_sensor_data *acc,
+                             uint16_t *acc_idx)
+{
+    switch (frame[0])
+    {
+        case BMI090L_FIFO_HEADER_ACC_FRM:
+        case BMI090L_FIFO_HEADER_ALL_FRM:
+            decode_accel_xyz(&acc[(*acc_idx)], &frame[1]);
+            (*acc_idx)++;
+            break;
+
+        case BMI090L_FIFO_HEADER_SENS_TIME_FRM:
+            parser->sensor_time = ((uint32_t)frame[3] << 16) | ((uint32_t)frame[2] << 8) | frame[1];
+            break;
+
+        case BMI090L_FIFO_HEADER_SKIP_FRM:
+            parser->skipped_frame_count = frame[1];
+            break;
+
+        /* Input configuration and sample drop frames carry no data */
+        default:
+            break;
+    }
+}
+
+/*!
+ * @brief This internal API decodes the accel FIFO frame at the parse index
+ * into an event.
+ */
+static int8_t get_fifo_event(struct bmi090l_fifo_event *event,
+                             struct bmi090l_fifo_frame *fifo,
+                             const struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    const uint8_t *frame = &fifo->data[fifo->acc_byte_start_idx];
+    uint8_t frame_len = get_fifo_frame_len(frame[0]);
+
+    if ((frame_len == 0) || ((fifo->acc_byte_start_idx + frame_len) > fifo->length))
+    {
+        /* Over-read marker, invalid header or a cut off frame */
+        rslt = BMI090L_W_FIFO_EMPTY;
+    }
+    else
+    {
+        switch (frame[0])
         {
-            case BMI090L_INT_CHANNEL_1:
+            case BMI090L_FIFO_HEADER_ACC_FRM:
+            case BMI090L_FIFO_HEADER_ALL_FRM:
+                event->type = BMI090L_FIFO_EVENT_ACCEL;
+                decode_accel_xyz(&event->accel, &frame[1]);
+                get_remapped_data(&event->accel, 1, dev);
+                break;
 
-                /* Updating the data */
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT1_FWM, conf);
+            case BMI090L_FIFO_HEADER_SENS_TIME_FRM:
+                event->type = BMI090L_FIFO_EVENT_SENSOR_TIME;
+                event->sensor_time = ((uint32_t)frame[3] << 16) | ((uint32_t)frame[2] << 8) | frame[1];
                 break;
 
-            case BMI090L_INT_CHANNEL_2:
+            case BMI090L_FIFO_HEADER_SKIP_FRM:
+                event->type = BMI090L_FIFO_EVENT_SKIP;
+                event->value = frame[1];
+                break;
 
-                /* Updating the data */
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT2_FWM, conf);
+            case BMI090L_FIFO_HEADER_INPUT_CFG_FRM:
+                event->type = BMI090L_FIFO_EVENT_INPUT_CFG;
+                event->value = frame[1];
                 break;
 
             default:
-                rslt = BMI090L_E_INVALID_INPUT;
+                event->type = BMI090L_FIFO_EVENT_SAMPLE_DROP;
+                event->value = frame[1];
                 break;
         }
 
-        if (rslt == BMI090L_OK)
-        {
-            /* Configure interrupt pins */
-            rslt = set_int_pin_config(int_config, dev);
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
-            }
-        }
+        fifo->acc_byte_start_idx += frame_len;
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API sets the FIFO full interrupt for accel sensor.
+ * @brief This internal API converts sensor time ticks to ns.
  */
-static int8_t set_accel_fifo_full_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+static uint64_t sensor_time_to_ns(uint64_t sensor_time)
 {
-    int8_t rslt;
-    uint8_t data = 0, conf;
+    return (sensor_time * BMI090L_SENSOR_TIME_TICK_NS_NUM) / BMI090L_SENSOR_TIME_TICK_NS_DEN;
+}
 
-    /* Read interrupt map register */
-    rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
+/*!
+ * @brief This internal API returns the gyro sample period of a gyro
+ * bandwidth/ODR setting.
+ */
+static uint32_t get_gyro_period_ns(uint8_t odr)
+{
+    uint32_t period;
 
-    if (rslt == BMI090L_OK)
+    switch (odr)
     {
-        conf = int_config->int_pin_cfg.enable_int_pin;
+        case BMI090L_GYRO_BW_532_ODR_2000_HZ:
+        case BMI090L_GYRO_BW_230_ODR_2000_HZ:
+            period = UINT32_C(500000);
+            break;
 
-        switch (int_config->int_channel)
-        {
-            case BMI090L_INT_CHANNEL_1:
+        case BMI090L_GYRO_BW_116_ODR_1000_HZ:
+            period = UINT32_C(1000000);
+            break;
 
-                /* Updating the data */
-                data = BMI090L_SET_BITS_POS_0(data, BMI090L_ACCEL_INT1_FFULL, conf);
-                break;
+        case BMI090L_GYRO_BW_47_ODR_400_HZ:
+            period = UINT32_C(2500000);
+            break;
 
-            case BMI090L_INT_CHANNEL_2:
+        case BMI090L_GYRO_BW_23_ODR_200_HZ:
+        case BMI090L_GYRO_BW_64_ODR_200_HZ:
+            period = UINT32_C(5000000);
+            break;
 
-                /* Updating the data */
-                data = BMI090L_SET_BITS(data, BMI090L_ACCEL_INT2_FFULL, conf);
-                break;
+        case BMI090L_GYRO_BW_12_ODR_100_HZ:
+        case BMI090L_GYRO_BW_32_ODR_100_HZ:
+            period = UINT32_C(10000000);
+            break;
 
-            default:
-                rslt = BMI090L_E_INVALID_INPUT;
-                break;
+        default:
+            period = 0;
+            break;
+    }
+
+    return period;
+}
+
+/*!
+ * @brief This internal API estimates the time of the last gyro sample of a
+ * gyro FIFO read.
+ */
+static int8_t estimate_gyro_time(uint16_t gyro_length,
+                                 struct bmi090l_fifo_merger *merger,
+                                 const struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint32_t nominal = get_gyro_period_ns(dev->gyro_cfg.odr);
+    uint64_t predicted;
+    uint64_t measured;
+    int64_t error;
+    int64_t period;
+
+    if (nominal == 0)
+    {
+        rslt = BMI090L_E_INVALID_CONFIG;
+    }
+    else
+    {
+        if (merger->gyro_valid != TRUE)
+        {
+            merger->gyro_period_ns = nominal;
         }
 
-        if (rslt == BMI090L_OK)
+        predicted = merger->gyro_time_ns + ((uint64_t)merger->gyro_period_ns * gyro_length);
+
+        if ((merger->accel_timeline.valid == TRUE) && (merger->accel_timeline.sensor_time != merger->sensor_time))
         {
-            /* Configure interrupt pins */
-            rslt = set_int_pin_config(int_config, dev);
+            /* The gyro FIFO is read right after the accel FIFO, its last
+             * sample is on average half a period before the sensor time */
+            measured = sensor_time_to_ns(merger->accel_timeline.sensor_time) - (merger->gyro_period_ns / 2);
+            error = (int64_t)(measured - predicted);
 
-            if (rslt == BMI090L_OK)
+            if ((merger->gyro_valid != TRUE) || (error > (BMI090L_GYRO_TIME_RESYNC * merger->gyro_period_ns)) ||
+                (error < -(BMI090L_GYRO_TIME_RESYNC * merger->gyro_period_ns)))
+            {
+                /* First read or lost frames, restart the tracking */
+                merger->gyro_time_ns = measured;
+                merger->gyro_period_ns = nominal;
+                merger->gyro_valid = TRUE;
+            }
+            else
             {
-                /* Write to interrupt map register */
-                rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA, &data, 1, dev);
+                /* Follow the gyro clock slowly, filtering the read jitter */
+                merger->gyro_time_ns = predicted + (uint64_t)(error / BMI090L_GYRO_TIME_GAIN);
+
+                if (gyro_length > 0)
+                {
+                    period = (int64_t)merger->gyro_period_ns + (error / (BMI090L_GYRO_PERIOD_GAIN * gyro_length));
+
+                    /* Keep the estimate within 1/16 of the nominal period */
+                    if (period > (int64_t)(nominal + (nominal / 16)))
+                    {
+                        period = (int64_t)(nominal + (nominal / 16));
+                    }
+                    else if (period < (int64_t)(nominal - (nominal / 16)))
+                    {
+                        period = (int64_t)(nominal - (nominal / 16));
+                    }
+
+                    merger->gyro_period_ns = (uint32_t)period;
+                }
             }
+
+            merger->sensor_time = merger->accel_timeline.sensor_time;
         }
+        else if (merger->gyro_valid == TRUE)
+        {
+            merger->gyro_time_ns = predicted;
+        }
+        else
+        {
+            rslt = BMI090L_W_NO_SENSOR_TIME;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This internal API interpolates linearly between two samples.
+ */
+static void interpolate_sample(const struct bmi090l_fifo_sample *prev,
+                               const struct bmi090l_fifo_sample *next,
+                               uint64_t time_ns,
+                               struct bmi090l_sensor_data *data)
+{
+    int64_t span;
+    int64_t offset;
+
+    if (next->time_ns <= prev->time_ns)
+    {
+        *data = next->data;
+    }
+    else
+    {
+        span = (int64_t)(next->time_ns - prev->time_ns);
+        offset = (int64_t)(time_ns - prev->time_ns);
+        data->x = (int16_t)(prev->data.x + (((int64_t)(next->data.x - prev->data.x) * offset) / span));
+        data->y = (int16_t)(prev->data.y + (((int64_t)(next->data.y - prev->data.y) * offset) / span));
+        data->z = (int16_t)(prev->data.z + (((int64_t)(next->data.z - prev->data.z) * offset) / span));
+    }
+}
+
+/*!
+ * @brief This internal API emits the oldest pending grid point of the
+ * resampler.
+ */
+static void resampler_emit(struct bmi090l_fifo_resampler *resampler, struct bmi090l_imu_sample *imu_data)
+{
+    imu_data->time_ns = resampler->time_ns;
+
+    if (resampler->fill[BMI090L_FIFO_SAMPLE_ACCEL] > 0)
+    {
+        imu_data->accel = resampler->pending[BMI090L_FIFO_SAMPLE_ACCEL][resampler->head];
+        resampler->fill[BMI090L_FIFO_SAMPLE_ACCEL]--;
+    }
+    else
+    {
+        imu_data->accel = resampler->last[BMI090L_FIFO_SAMPLE_ACCEL].data;
+    }
+
+    if (resampler->fill[BMI090L_FIFO_SAMPLE_GYRO] > 0)
+    {
+        imu_data->gyro = resampler->pending[BMI090L_FIFO_SAMPLE_GYRO][resampler->head];
+        resampler->fill[BMI090L_FIFO_SAMPLE_GYRO]--;
+    }
+    else
+    {
+        imu_data->gyro = resampler->last[BMI090L_FIFO_SAMPLE_GYRO].data;
+    }
+
+    resampler->head = (uint8_t)((resampler->head + 1) % BMI090L_FIFO_RESAMPLE_DEPTH);
+    resampler->time_ns += resampler->period_ns;
+}
+
+/*!
+ * @brief This internal API returns the FIFO watermark leaving room for the
+ * frames of the given time.
+ */
+static uint16_t get_fifo_wm_frames(uint64_t margin_ns, uint64_t period_ns, uint16_t capacity)
+{
+    /* Frames arriving in the margin, rounded up, plus the one being written */
+    uint64_t frames = ((margin_ns + period_ns - 1) / period_ns) + 1;
+    uint16_t wm = 1;
+
+    if (frames < capacity)
+    {
+        wm = (uint16_t)(capacity - frames);
+    }
+
+    return wm;
+}
+
+/*!
+ * @brief This internal API decides whether a new watermark is written.
+ */
+static uint8_t fifo_wm_changed(uint16_t wm, uint16_t new_wm, uint16_t capacity)
+{
+    uint8_t changed = FALSE;
+
+    if ((new_wm < wm) || (new_wm > (wm + (capacity >> BMI090L_FIFO_WM_HYSTERESIS_SHIFT))))
+    {
+        changed = TRUE;
+    }
+
+    return changed;
+}
+
+/*!
+ * @brief This API sets the FIFO water mark interrupt for accel sensor.
+ */
+static int8_t set_accel_fifo_wm_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t mask = 0;
+
+    switch (int_config->int_channel)
+    {
+        case BMI090L_INT_CHANNEL_1:
+            mask = BMI090L_ACCEL_INT1_FWM_MASK;
+            break;
+
+        case BMI090L_INT_CHANNEL_2:
+            mask = BMI090L_ACCEL_INT2_FWM_MASK;
+            break;
+
+        default:
+            rslt = BMI090L_E_INVALID_INPUT;
+            break;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        /* Update interrupt map and pin configuration */
+        rslt = set_int_map(int_config,
+                           BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA,
+                           mask,
+                           int_config->int_pin_cfg.enable_int_pin & BMI090L_ENABLE,
+                           dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API sets the FIFO full interrupt for accel sensor.
+ */
+static int8_t set_accel_fifo_full_int(const struct bmi090l_accel_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t mask = 0;
+
+    switch (int_config->int_channel)
+    {
+        case BMI090L_INT_CHANNEL_1:
+            mask = BMI090L_ACCEL_INT1_FFULL_MASK;
+            break;
+
+        case BMI090L_INT_CHANNEL_2:
+            mask = BMI090L_ACCEL_INT2_FFULL_MASK;
+            break;
+
+        default:
+            rslt = BMI090L_E_INVALID_INPUT;
+            break;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        /* Update interrupt map and pin configuration */
+        rslt = set_int_map(int_config,
+                           BMI090L_REG_ACCEL_INT1_INT2_MAP_DATA,
+                           mask,
+                           int_config->int_pin_cfg.enable_int_pin & BMI090L_ENABLE,
+                           dev);
     }
 
     return rslt;
@@ -3790,11 +7201,8 @@ static int8_t set_remap_axes(const struct bmi090l_axes_remap *remap_data, struct
     /* Variable to hold execution status */
     int8_t rslt;
 
-    /* Initialize configuration file */
-    uint8_t feature_config[BMI090L_FEATURE_SIZE] = { 0 };
-
-    /* Initialize index to set re-mapped data */
-    uint8_t index = BMI090L_ADDR_AXES_REMAP_START;
+    /* Re-mapping word of the feature configuration */
+    uint16_t remap_word;
 
     /* Variable to define x-axis to be re-mapped */
     uint8_t x_axis;
@@ -3816,38 +7224,29 @@ static int8_t set_remap_axes(const struct bmi090l_axes_remap *remap_data, struct
 
     if (remap_data != NULL)
     {
-        /* Read the configuration file */
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, feature_config, BMI090L_FEATURE_SIZE, dev);
-
-        if (rslt == BMI090L_OK)
-        {
-            /* Get x-axis to be re-mapped */
-            x_axis = remap_data->x_axis & BMI090L_X_AXIS_MASK;
+        /* Get x-axis to be re-mapped */
+        x_axis = remap_data->x_axis & BMI090L_X_AXIS_MASK;
 
-            /* Get x-axis sign to be re-mapped */
-            x_axis_sign = (remap_data->x_axis_sign << BMI090L_X_AXIS_SIGN_POS) & BMI090L_X_AXIS_SIGN_MASK;
+        /* Get x-axis sign to be re-mapped */
+        x_axis_sign = (remap_data->x_axis_sign << BMI090L_X_AXIS_SIGN_POS) & BMI090L_X_AXIS_SIGN_MASK;
 
-            /* Get y-axis to be re-mapped */
-            y_axis = (remap_data->y_axis << BMI090L_Y_AXIS_POS) & BMI090L_Y_AXIS_MASK;
+        /* Get y-axis to be re-mapped */
+        y_axis = (remap_data->y_axis << BMI090L_Y_AXIS_POS) & BMI090L_Y_AXIS_MASK;
 
-            /* Get y-axis sign to be re-mapped */
-            y_axis_sign = (remap_data->y_axis_sign << BMI090L_Y_AXIS_SIGN_POS) & BMI090L_Y_AXIS_SIGN_MASK;
+        /* Get y-axis sign to be re-mapped */
+        y_axis_sign = (remap_data->y_axis_sign << BMI090L_Y_AXIS_SIGN_POS) & BMI090L_Y_AXIS_SIGN_MASK;
 
-            /* Get z-axis to be re-mapped */
-            z_axis = (remap_data->z_axis << BMI090L_Z_AXIS_POS) & BMI090L_Z_AXIS_MASK;
+        /* Get z-axis to be re-mapped */
+        z_axis = (remap_data->z_axis << BMI090L_Z_AXIS_POS) & BMI090L_Z_AXIS_MASK;
 
-            /* Get z-axis sign to be re-mapped */
-            z_axis_sign = remap_data->z_axis_sign & BMI090L_Z_AXIS_SIGN_MASK;
+        /* Get z-axis sign to be re-mapped */
+        z_axis_sign = remap_data->z_axis_sign & BMI090L_Z_AXIS_SIGN_MASK;
 
-            /* Set the first byte for axis re-mapping */
-            feature_config[index] = x_axis | x_axis_sign | y_axis | y_axis_sign | z_axis;
+        /* First byte holds the axes, second byte the z-axis sign */
+        remap_word = (uint16_t)(((uint16_t)z_axis_sign << 8) | x_axis | x_axis_sign | y_axis | y_axis_sign | z_axis);
 
-            /* Set the second byte for axis re-mapping */
-            feature_config[index + 1] = z_axis_sign;
-
-            /* Set the re-mapped axes */
-            rslt = bmi090la_set_regs(BMI090L_REG_ACCEL_FEATURE_CFG, feature_config, BMI090L_FEATURE_SIZE, dev);
-        }
+        /* Set the re-mapped axes */
+        rslt = bmi090la_write_feature_config(BMI090L_ADDR_AXES_REMAP_START / 2, &remap_word, 1, dev);
     }
     else
     {
@@ -3865,36 +7264,39 @@ static int8_t get_remap_axes(struct bmi090l_axes_remap *remap_data, struct bmi09
     /* Variable to hold execution status */
     int8_t rslt;
 
-    /* Initialize configuration file */
-    uint8_t feature_config[BMI090L_FEATURE_SIZE] = { 0 };
+    /* Re-mapping word of the feature configuration */
+    uint16_t remap_word = 0;
 
-    /* Initialize index to get re-mapped data */
-    uint8_t index = BMI090L_ADDR_AXES_REMAP_START;
+    /* Bytes of the re-mapping word */
+    uint8_t remap_lsb, remap_msb;
 
     if (remap_data != NULL)
     {
-        /* Read the configuration file */
-        rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_FEATURE_CFG, feature_config, BMI090L_FEATURE_SIZE, dev);
+        /* Read the re-mapping word */
+        rslt = feature_get_words(BMI090L_ADDR_AXES_REMAP_START / 2, &remap_word, 1, dev);
 
         if (rslt == BMI090L_OK)
         {
+            remap_lsb = (uint8_t)(remap_word & 0xFF);
+            remap_msb = (uint8_t)(remap_word >> 8);
+
             /* Get re-mapped x-axis */
-            remap_data->x_axis = BMI090L_GET_BITS_POS_0(feature_config[index], BMI090L_X_AXIS);
+            remap_data->x_axis = BMI090L_GET_BITS_POS_0(remap_lsb, BMI090L_X_AXIS);
 
             /* Get re-mapped x-axis sign */
-            remap_data->x_axis_sign = BMI090L_GET_BITSLICE(feature_config[index], BMI090L_X_AXIS_SIGN);
+            remap_data->x_axis_sign = BMI090L_GET_BITSLICE(remap_lsb, BMI090L_X_AXIS_SIGN);
 
             /* Get re-mapped y-axis */
-            remap_data->y_axis = BMI090L_GET_BITSLICE(feature_config[index], BMI090L_Y_AXIS);
+            remap_data->y_axis = BMI090L_GET_BITSLICE(remap_lsb, BMI090L_Y_AXIS);
 
             /* Get re-mapped y-axis sign */
-            remap_data->y_axis_sign = BMI090L_GET_BITSLICE(feature_config[index], BMI090L_Y_AXIS_SIGN);
+            remap_data->y_axis_sign = BMI090L_GET_BITSLICE(remap_lsb, BMI090L_Y_AXIS_SIGN);
 
             /* Get re-mapped z-axis */
-            remap_data->z_axis = BMI090L_GET_BITSLICE(feature_config[index], BMI090L_Z_AXIS);
+            remap_data->z_axis = BMI090L_GET_BITSLICE(remap_lsb, BMI090L_Z_AXIS);
 
             /* Get re-mapped z-axis sign */
-            remap_data->z_axis_sign = BMI090L_GET_BITS_POS_0(feature_config[index + 1], BMI090L_Z_AXIS_SIGN);
+            remap_data->z_axis_sign = BMI090L_GET_BITS_POS_0(remap_msb, BMI090L_Z_AXIS_SIGN);
         }
     }
     else
@@ -3908,46 +7310,58 @@ static int8_t get_remap_axes(struct bmi090l_axes_remap *remap_data, struct bmi09
 /*!
  * @brief This internal API gets the re-mapped accelerometer/gyroscope data.
  */
-static void get_remapped_data(struct bmi090l_sensor_data *data, const struct bmi090l_dev *dev)
+static void get_remapped_data(struct bmi090l_sensor_data *data, uint16_t count, const struct bmi090l_dev *dev)
 {
-    /* Array to defined the re-mapped sensor data */
-    int16_t remap_data[3] = { 0 };
-    int16_t pos_multiplier = INT16_C(1);
-    int16_t neg_multiplier = INT16_C(-1);
+    /* Array to hold the un-mapped sensor data */
+    int16_t remap_data[3];
+    uint16_t indx;
 
-    /* Fill the array with the un-mapped sensor data */
-    remap_data[0] = data->x;
-    remap_data[1] = data->y;
-    remap_data[2] = data->z;
+    /* Source axis and sign of each output axis, taken once for the whole batch */
+    uint8_t x_axis = dev->remap.x_axis;
+    uint8_t y_axis = dev->remap.y_axis;
+    uint8_t z_axis = dev->remap.z_axis;
+    int16_t x_mul = (dev->remap.x_axis_sign == BMI090L_MAP_POSITIVE) ? INT16_C(1) : INT16_C(-1);
+    int16_t y_mul = (dev->remap.y_axis_sign == BMI090L_MAP_POSITIVE) ? INT16_C(1) : INT16_C(-1);
+    int16_t z_mul = (dev->remap.z_axis_sign == BMI090L_MAP_POSITIVE) ? INT16_C(1) : INT16_C(-1);
 
-    /* Get the re-mapped x axis data */
-    if (dev->remap.x_axis_sign == BMI090L_MAP_POSITIVE)
-    {
-        data->x = (int16_t)(remap_data[dev->remap.x_axis] * pos_multiplier);
-    }
-    else
+    /* No branch per sample, each axis is a table look-up and a multiply */
+    for (indx = 0; indx < count; indx++)
     {
-        data->x = (int16_t)(remap_data[dev->remap.x_axis] * neg_multiplier);
-    }
+        remap_data[0] = data[indx].x;
+        remap_data[1] = data[indx].y;
+        remap_data[2] = data[indx].z;
 
-    /* Get the re-mapped y axis data */
-    if (dev->remap.y_axis_sign == BMI090L_MAP_POSITIVE)
-    {
-        data->y = (int16_t)(remap_data[dev->remap.y_axis] * pos_multiplier);
+        data[indx].x = (int16_t)(remap_data[x_axis] * x_mul);
+        data[indx].y = (int16_t)(remap_data[y_axis] * y_mul);
+        data[indx].z = (int16_t)(remap_data[z_axis] * z_mul);
     }
-    else
+}
+
+/*!
+ * @brief This internal API appends one sample to a sample ring.
+ */
+static void sample_ring_put(struct bmi090l_sample_ring *ring,
+                            const struct bmi090l_sensor_data *data,
+                            uint32_t time_us)
+{
+    ring->x[ring->head] = data->x;
+    ring->y[ring->head] = data->y;
+    ring->z[ring->head] = data->z;
+
+    if (ring->time_us != NULL)
     {
-        data->y = (int16_t)(remap_data[dev->remap.y_axis] * neg_multiplier);
+        ring->time_us[ring->head] = time_us;
     }
 
-    /* Get the re-mapped z axis data */
-    if (dev->remap.z_axis_sign == BMI090L_MAP_POSITIVE)
+    ring->head++;
+    if (ring->head >= ring->size)
     {
-        data->z = (int16_t)(remap_data[dev->remap.z_axis] * pos_multiplier);
+        ring->head = 0;
     }
-    else
+
+    if (ring->count < ring->size)
     {
-        data->z = (int16_t)(remap_data[dev->remap.z_axis] * neg_multiplier);
+        ring->count++;
     }
 }
 
@@ -4101,7 +7515,11 @@ static int8_t write_config_file(struct bmi090l_dev *dev)
         if (rslt == BMI090L_OK)
         {
             /* Wait till ASIC is initialized. Refer the data-sheet for more information */
-            dev->delay_us(BMI090L_ASIC_INIT_TIME_MS * 1000, dev->intf_ptr_accel);
+            wait_ready(BMI090L_REG_ACCEL_INTERNAL_STAT,
+                       0xFF,
+                       BMI090L_ASIC_INITIALIZED,
+                       (uint32_t)BMI090L_ASIC_INIT_TIME_MS * 1000,
+                       dev);
 
             /* Check for config initialization status (1 = OK) */
             rslt = bmi090la_get_regs(BMI090L_REG_ACCEL_INTERNAL_STAT, &reg_data, 1, dev);
@@ -122,17 +122,166 @@ static int8_t set_gyro_data_ready_int(const struct bmi090l_gyro_int_channel_cfg
 static int8_t set_fifo_int(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev);
 
 /*!
- * @brief This API configures the pins which fire the
- * interrupt signal when any interrupt occurs.
+ * @brief This API updates the interrupt pin configuration register value
+ * with the user settings.
  *
  * @param[in] int_config  : Structure instance of bmi090l_gyro_int_channel_cfg.
- * @param[in] dev         : Structure instance of bmi090l_dev.
+ * @param[in] data        : Current register value.
+ *
+ * @return Updated register value
+ */
+static uint8_t get_int_pin_conf(const struct bmi090l_gyro_int_channel_cfg *int_config, uint8_t data);
+
+/*!
+ * @brief This API reads or writes the interrupt map, interrupt pin
+ * configuration and interrupt control registers in one batch.
+ *
+ * @param[in] dir     : BMI090L_XFER_READ or BMI090L_XFER_WRITE.
+ * @param[in,out] data : Register values in the order map, pin configuration, control.
+ * @param[in] count   : Number of registers, starting with the map register.
+ * @param[in] dev     : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t int_regs_xfer(uint8_t dir, uint8_t *data, uint8_t count, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API performs a list of register transactions. With a vectored
+ * callback the list is submitted in one call, otherwise each segment is
+ * performed through the read and write callbacks.
+ *
+ * @param[in,out] seg   : Segments with plain register addresses.
+ * @param[in]     count : Number of segments.
+ * @param[in]     dev   : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t xfer_regs(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API performs a list of register transactions on the bus,
+ * without the shadow register cache.
+ *
+ * @param[in,out] seg   : Segments with plain register addresses.
+ * @param[in]     count : Number of segments.
+ * @param[in]     dev   : Structure instance of bmi090l_dev.
+ *
+ * @return Result of API execution status
+ * @retval 0 -> Success
+ * @retval < 0 -> Fail
+ */
+static int8_t xfer_regs_bus(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the shadow cache index of a register.
+ *
+ * @param[in] reg_addr : Register address.
+ *
+ * @return Index in the gyro shadow, BMI090L_SHADOW_GYRO_LEN if not cached
+ */
+static uint8_t shadow_index(uint8_t reg_addr);
+
+/*!
+ * @brief This API answers a register read from the shadow cache.
+ *
+ * @param[in]  reg_addr : Register address from where the data to be read.
+ * @param[out] data     : Data read.
+ * @param[in]  len      : No. of bytes of data to be read.
+ * @param[in]  dev      : Structure instance of bmi090l_dev.
+ *
+ * @return TRUE if all bytes were answered from the cache, FALSE otherwise
+ */
+static uint8_t shadow_get(uint8_t reg_addr, uint8_t *data, uint32_t len, const struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API updates the shadow cache after a successful register read
+ * or write. A soft reset command or deep suspend invalidates the cache.
+ *
+ * @param[in] reg_addr : Register address.
+ * @param[in] data     : Data read from or written to the sensor.
+ * @param[in] len      : No. of bytes.
+ * @param[in] dir      : BMI090L_XFER_READ or BMI090L_XFER_WRITE.
+ * @param[in] dev      : Structure instance of bmi090l_dev.
+ */
+static void shadow_store(uint8_t reg_addr, const uint8_t *data, uint32_t len, uint8_t dir, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API reads all cached registers into the shadow cache.
+ *
+ * @param[in] dev : Structure instance of bmi090l_dev.
  *
  * @return Result of API execution status
  * @retval 0 -> Success
  * @retval < 0 -> Fail
  */
-static int8_t set_int_pin_config(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev);
+static int8_t shadow_fill(struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API waits until a masked gyro register reads the given value.
+ * With BMI090L_WAIT_FIXED it sleeps the full timeout instead. A poll timing
+ * out or failing is not an error, the caller checks the sensor state as it
+ * does after the fixed delay.
+ *
+ * @param[in] reg_addr   : Register address.
+ * @param[in] mask       : Mask applied to the register value.
+ * @param[in] value      : Masked value of a ready sensor.
+ * @param[in] timeout_us : Worst-case time until the sensor is ready.
+ * @param[in] dev        : Structure instance of bmi090l_dev.
+ */
+static void wait_ready(uint8_t reg_addr, uint8_t mask, uint8_t value, uint32_t timeout_us, struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API is the non-blocking counterpart of wait_ready(). The first
+ * call starts the wait, later calls poll the register with BMI090L_WAIT_POLL.
+ *
+ * @param[in,out] ctx     : Initialization context.
+ * @param[in] reg_addr    : Register address.
+ * @param[in] mask        : Mask applied to the register value.
+ * @param[in] value       : Masked value of a ready sensor.
+ * @param[in] timeout_us  : Worst-case time until the sensor is ready.
+ * @param[out] wait_us    : Time until the next call, 0 once the wait is over.
+ * @param[in] dev         : Structure instance of bmi090l_dev.
+ *
+ * @return TRUE once the sensor is ready or the timeout has passed
+ */
+static uint8_t init_wait(struct bmi090l_init_ctx *ctx,
+                         uint8_t reg_addr,
+                         uint8_t mask,
+                         uint8_t value,
+                         uint32_t timeout_us,
+                         uint32_t *wait_us,
+                         struct bmi090l_dev *dev);
+
+/*!
+ * @brief This API returns the first state of the next initialization step
+ * selected by the user, starting at the given step.
+ *
+ * @param[in] steps : Selected BMI090L_INIT_* steps.
+ * @param[in] state : First state of the candidate step.
+ *
+ * @return Next initialization state
+ */
+static uint8_t init_next(uint8_t steps, uint8_t state);
+
+/*!
+ * @brief This internal API appends one sample to a sample ring, overwriting
+ * the oldest entry once the ring is full.
+ *
+ * @param[in,out] ring    : Sample ring.
+ * @param[in]     data    : Sample to append.
+ * @param[in]     time_us : Timestamp of the sample, stored if ring->time_us is set.
+ *
+ * @return None
+ *
+ * @retval None
+ */
+static void sample_ring_put(struct bmi090l_sample_ring *ring,
+                            const struct bmi090l_sensor_data *data,
+                            uint32_t time_us);
 
 /*!
  *  @brief This API enables or disables the Gyro Self test feature in the
@@ -194,6 +343,27 @@ static void unpack_gyro_data(struct bmi090l_sensor_data *gyro,
                              const struct bmi090l_gyr_fifo_config *fifo_conf,
                              const struct bmi090l_fifo_frame *fifo);
 
+/*!
+ * @brief This internal API unpacks XYZ gyroscope FIFO frames into x, y, z
+ * triplets.
+ *
+ * @param[out] gyro_data : Unpacked data, three values per frame.
+ * @param[out] tag       : Interrupt tag per frame, NULL if the frames are untagged.
+ * @param[in]  count     : Number of frames.
+ * @param[in]  fifo_data : FIFO data.
+ */
+static void unpack_gyro_xyz(int16_t *gyro_data, uint16_t *tag, uint16_t count, const uint8_t *fifo_data);
+
+/*!
+ * @brief This internal API unpacks single axis gyroscope FIFO frames.
+ *
+ * @param[out] gyro_data : Unpacked data, one value per frame.
+ * @param[out] tag       : Interrupt tag per frame, NULL if the frames are untagged.
+ * @param[in]  count     : Number of frames.
+ * @param[in]  fifo_data : FIFO data.
+ */
+static void unpack_gyro_axis(int16_t *gyro_data, uint16_t *tag, uint16_t count, const uint8_t *fifo_data);
+
 /****************************************************************************/
 
 /**\name        Extern Declarations
@@ -219,6 +389,14 @@ int8_t bmi090lg_init(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t chip_id = 0;
 
+    /* Without the opt-in key the optional members may hold garbage, see bmi090l_dev.ext_key */
+    if ((dev != NULL) && (dev->ext_key != BMI090L_DEV_EXT_KEY))
+    {
+        (void)bmi090l_set_dev_defaults(dev);
+    }
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_INIT);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -234,6 +412,8 @@ int8_t bmi090lg_init(struct bmi090l_dev *dev)
             {
                 /* Store the chip ID in dev structure */
                 dev->gyro_chip_id = chip_id;
+
+                rslt = shadow_fill(dev);
             }
             else
             {
@@ -242,6 +422,184 @@ int8_t bmi090lg_init(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API prepares the non-blocking initialization of the gyro sensor.
+ */
+int8_t bmi090lg_init_start(struct bmi090l_init_ctx *ctx, uint8_t steps, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    /* Without the opt-in key the optional members may hold garbage, see bmi090l_dev.ext_key */
+    if ((dev != NULL) && (dev->ext_key != BMI090L_DEV_EXT_KEY))
+    {
+        (void)bmi090l_set_dev_defaults(dev);
+    }
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_INIT_START);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && (ctx != NULL))
+    {
+        /* The gyro has no config file */
+        ctx->steps = steps & (uint8_t)~BMI090L_INIT_CONFIG_FILE;
+        ctx->state = BMI090L_INIT_STATE_START;
+        ctx->index = 0;
+        ctx->waited_us = 0;
+        ctx->backoff_us = 0;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API runs the next step of the non-blocking initialization of
+ *  the gyro sensor.
+ */
+int8_t bmi090lg_init_step(struct bmi090l_init_ctx *ctx, uint32_t *wait_us, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data = 0;
+    uint8_t power_mode;
+    uint8_t stale[6];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_INIT_STEP);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && ((ctx == NULL) || (wait_us == NULL)))
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        *wait_us = 0;
+        power_mode = dev->gyro_cfg.power;
+
+        switch (ctx->state)
+        {
+            case BMI090L_INIT_STATE_START:
+
+                /* Chip ID check */
+                rslt = bmi090lg_init(dev);
+                ctx->state = init_next(ctx->steps, BMI090L_INIT_STATE_RESET);
+                break;
+
+            case BMI090L_INIT_STATE_RESET:
+
+                /* Reset gyro device, the chip ID reads back once booted */
+                data = BMI090L_SOFT_RESET_CMD;
+                rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_SOFTRESET, &data, 1, dev);
+                ctx->state = BMI090L_INIT_STATE_RESET_WAIT;
+                (void)init_wait(ctx,
+                                BMI090L_REG_GYRO_CHIP_ID,
+                                0xFF,
+                                BMI090L_GYRO_CHIP_ID,
+                                BMI090L_GYRO_SOFTRESET_DELAY * 1000,
+                                wait_us,
+                                dev);
+                break;
+
+            case BMI090L_INIT_STATE_RESET_WAIT:
+                if (init_wait(ctx, BMI090L_REG_GYRO_CHIP_ID, 0xFF, BMI090L_GYRO_CHIP_ID,
+                              BMI090L_GYRO_SOFTRESET_DELAY * 1000, wait_us, dev))
+                {
+                    /* The reset cleared the shadow cache, read back the reset values */
+                    rslt = shadow_fill(dev);
+                    ctx->state = init_next(ctx->steps, BMI090L_INIT_STATE_POWER);
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_POWER:
+
+                /* Read the previous power state */
+                rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_LPM1, &data, 1, dev);
+
+                /* It is not possible to switch between suspend and deep suspend */
+                if ((rslt == BMI090L_OK) &&
+                    (((power_mode == BMI090L_GYRO_PM_SUSPEND) && (data == BMI090L_GYRO_PM_DEEP_SUSPEND)) ||
+                     ((power_mode == BMI090L_GYRO_PM_DEEP_SUSPEND) && (data == BMI090L_GYRO_PM_SUSPEND))))
+                {
+                    rslt = BMI090L_E_INVALID_INPUT;
+                }
+
+                if ((rslt == BMI090L_OK) && (dev->wait_mode == BMI090L_WAIT_POLL) &&
+                    (power_mode == BMI090L_GYRO_PM_NORMAL))
+                {
+                    /* Clear a stale data ready flag by reading the data registers */
+                    rslt = get_regs(BMI090L_REG_GYRO_X_LSB, stale, sizeof(stale), dev);
+                }
+
+                if (rslt == BMI090L_OK)
+                {
+                    /* Write power to power register */
+                    rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_LPM1, &power_mode, 1, dev);
+                    ctx->state = BMI090L_INIT_STATE_POWER_WAIT;
+                }
+
+                if ((rslt == BMI090L_OK) && (power_mode == BMI090L_GYRO_PM_NORMAL))
+                {
+                    /* Wait for the first sample, at most the power mode switch time */
+                    (void)init_wait(ctx,
+                                    BMI090L_REG_GYRO_INT_STAT_1,
+                                    BMI090L_GYRO_DATA_READY_INT,
+                                    BMI090L_GYRO_DATA_READY_INT,
+                                    BMI090L_GYRO_POWER_MODE_CONFIG_DELAY * 1000,
+                                    wait_us,
+                                    dev);
+                }
+                else if (rslt == BMI090L_OK)
+                {
+                    /* Time required to switch the power mode */
+                    *wait_us = BMI090L_GYRO_POWER_MODE_CONFIG_DELAY * 1000;
+                }
+
+                break;
+
+            case BMI090L_INIT_STATE_POWER_WAIT:
+                if ((power_mode != BMI090L_GYRO_PM_NORMAL) ||
+                    init_wait(ctx, BMI090L_REG_GYRO_INT_STAT_1, BMI090L_GYRO_DATA_READY_INT, BMI090L_GYRO_DATA_READY_INT,
+                              BMI090L_GYRO_POWER_MODE_CONFIG_DELAY * 1000, wait_us, dev))
+                {
+                    ctx->state = BMI090L_INIT_STATE_DONE;
+                }
+
+                break;
+
+            default:
+                break;
+        }
+
+        if (rslt != BMI090L_OK)
+        {
+            /* Stop, the initialization has to be started again */
+            ctx->state = BMI090L_INIT_STATE_DONE;
+            ctx->backoff_us = 0;
+            *wait_us = 0;
+        }
+        else if (ctx->state != BMI090L_INIT_STATE_DONE)
+        {
+            rslt = BMI090L_W_IN_PROGRESS;
+        }
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -253,6 +611,8 @@ int8_t bmi090lg_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, stru
 {
     int8_t rslt;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_REGS);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -274,6 +634,8 @@ int8_t bmi090lg_get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, stru
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -285,6 +647,8 @@ int8_t bmi090lg_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len
 {
     int8_t rslt;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SET_REGS);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -306,6 +670,8 @@ int8_t bmi090lg_set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -317,6 +683,8 @@ int8_t bmi090lg_soft_reset(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SOFT_RESET);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -329,11 +697,16 @@ int8_t bmi090lg_soft_reset(struct bmi090l_dev *dev)
 
         if (rslt == BMI090L_OK)
         {
-            /* Delay 30 ms after writing reset value to its register */
-            dev->delay_us(BMI090L_GYRO_SOFTRESET_DELAY * 1000, dev->intf_ptr_gyro);
+            /* Wait up to 30 ms after writing reset value to its register, the chip ID reads back once booted */
+            wait_ready(BMI090L_REG_GYRO_CHIP_ID, 0xFF, BMI090L_GYRO_CHIP_ID, BMI090L_GYRO_SOFTRESET_DELAY * 1000, dev);
+
+            /* The reset cleared the shadow cache, read back the reset values */
+            rslt = shadow_fill(dev);
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -346,6 +719,8 @@ int8_t bmi090lg_get_meas_conf(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data[2];
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_MEAS_CONF);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -362,6 +737,8 @@ int8_t bmi090lg_get_meas_conf(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -372,10 +749,13 @@ int8_t bmi090lg_get_meas_conf(struct bmi090l_dev *dev)
 int8_t bmi090lg_set_meas_conf(struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data;
+    uint8_t data[2];
+    struct bmi090l_xfer_seg seg[2];
     uint8_t odr, range;
     uint8_t is_range_invalid = FALSE, is_odr_invalid = FALSE;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SET_MEAS_CONF);
+
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
@@ -400,29 +780,24 @@ int8_t bmi090lg_set_meas_conf(struct bmi090l_dev *dev)
         /* If ODR and Range is valid, write it to gyro config. registers */
         if ((!is_odr_invalid) && (!is_range_invalid))
         {
-            /* Read range value from the range register */
-            rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_BANDWIDTH, &data, 1, dev);
-
-            if (rslt == BMI090L_OK)
-            {
-                data = BMI090L_SET_BITS_POS_0(data, BMI090L_GYRO_BW, odr);
-
-                /* Write odr value to odr register */
-                rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_BANDWIDTH, &data, 1, dev);
-            }
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Read range value from the range register */
-                rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_RANGE, &data, 1, dev);
-            }
+            /* Read range and bandwidth registers in one burst */
+            rslt = get_regs(BMI090L_REG_GYRO_RANGE, data, 2, dev);
 
             if (rslt == BMI090L_OK)
             {
-                data = BMI090L_SET_BITS_POS_0(data, BMI090L_GYRO_RANGE, range);
-
-                /* Write range value to range register */
-                rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_RANGE, &data, 1, dev);
+                data[1] = BMI090L_SET_BITS_POS_0(data[1], BMI090L_GYRO_BW, odr);
+                data[0] = BMI090L_SET_BITS_POS_0(data[0], BMI090L_GYRO_RANGE, range);
+
+                /* Write odr value to odr register, then range value to range register */
+                seg[0].reg_addr = BMI090L_REG_GYRO_BANDWIDTH;
+                seg[0].dir = BMI090L_XFER_WRITE;
+                seg[0].data = &data[1];
+                seg[0].len = 1;
+                seg[1].reg_addr = BMI090L_REG_GYRO_RANGE;
+                seg[1].dir = BMI090L_XFER_WRITE;
+                seg[1].data = &data[0];
+                seg[1].len = 1;
+                rslt = xfer_regs(seg, 2, dev);
             }
 
             if (rslt == BMI090L_OK)
@@ -438,6 +813,8 @@ int8_t bmi090lg_set_meas_conf(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -452,6 +829,8 @@ int8_t bmi090lg_get_power_mode(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t data;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_POWER_MODE);
+
     /* Check for null pointer in the device structure*/
     rslt = null_ptr_check(dev);
 
@@ -467,6 +846,8 @@ int8_t bmi090lg_get_power_mode(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -478,6 +859,9 @@ int8_t bmi090lg_set_power_mode(struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t power_mode, data;
     uint8_t is_power_switching_mode_valid = TRUE;
+    uint8_t stale[6];
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SET_POWER_MODE);
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
@@ -511,10 +895,28 @@ int8_t bmi090lg_set_power_mode(struct bmi090l_dev *dev)
             /* Check if power switching mode is valid*/
             if (is_power_switching_mode_valid)
             {
-                /* Write power to power register */
-                rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_LPM1, &power_mode, 1, dev);
+                if ((dev->wait_mode == BMI090L_WAIT_POLL) && (power_mode == BMI090L_GYRO_PM_NORMAL))
+                {
+                    /* Clear a stale data ready flag by reading the data registers */
+                    rslt = get_regs(BMI090L_REG_GYRO_X_LSB, stale, sizeof(stale), dev);
+                }
 
                 if (rslt == BMI090L_OK)
+                {
+                    /* Write power to power register */
+                    rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_LPM1, &power_mode, 1, dev);
+                }
+
+                if ((rslt == BMI090L_OK) && (power_mode == BMI090L_GYRO_PM_NORMAL))
+                {
+                    /* Wait for the first sample, at most the power mode switch time */
+                    wait_ready(BMI090L_REG_GYRO_INT_STAT_1,
+                               BMI090L_GYRO_DATA_READY_INT,
+                               BMI090L_GYRO_DATA_READY_INT,
+                               BMI090L_GYRO_POWER_MODE_CONFIG_DELAY * 1000,
+                               dev);
+                }
+                else if (rslt == BMI090L_OK)
                 {
                     /* Time required to switch the power mode */
                     dev->delay_us(BMI090L_GYRO_POWER_MODE_CONFIG_DELAY * 1000, dev->intf_ptr_gyro);
@@ -528,6 +930,8 @@ int8_t bmi090lg_set_power_mode(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -543,6 +947,8 @@ int8_t bmi090lg_get_data(struct bmi090l_sensor_data *gyro, struct bmi090l_dev *d
     uint8_t lsb, msb;
     uint16_t msblsb;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_DATA);
+
     /* Check for null pointer in the device structure*/
     rslt = null_ptr_check(dev);
 
@@ -575,68 +981,260 @@ int8_t bmi090lg_get_data(struct bmi090l_sensor_data *gyro, struct bmi090l_dev *d
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- * @brief This API configures the necessary gyro interrupt
- * based on the user settings in the bmi090l_int_cfg
- * structure instance.
+ *  @brief This API polls the gyro data ready status and appends the
+ *  samples to a ring in structure-of-arrays layout.
  */
-int8_t bmi090lg_set_int_config(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+int8_t bmi090lg_poll_samples(struct bmi090l_sample_ring *ring, uint16_t count, uint16_t *n_read,
+                             struct bmi090l_dev *dev)
 {
     int8_t rslt;
+    uint8_t data[6];
+    uint8_t status = 0;
+    uint16_t read = 0;
+    uint32_t waited = 0;
+    uint32_t time_us = 0;
+    struct bmi090l_sensor_data sample;
 
-    /* Check for null pointer in the device structure*/
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_POLL_SAMPLES);
+
+    /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
     /* Proceed if null check is fine */
-    if ((rslt == BMI090L_OK) && (int_config != NULL))
+    if ((rslt == BMI090L_OK) && (ring != NULL) && (n_read != NULL) && (ring->x != NULL) && (ring->y != NULL) &&
+        (ring->z != NULL) && ((ring->time_us == NULL) || (dev->timestamp_us != NULL)))
     {
-        switch (int_config->int_type)
+        /* A ring state out of range would make the writes go past the arrays */
+        if ((ring->size == 0) || (ring->head >= ring->size) || (ring->count > ring->size))
         {
-            case BMI090L_GYRO_INT_DATA_RDY:
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
 
-                /* Data ready interrupt */
-                rslt = set_gyro_data_ready_int(int_config, dev);
-                break;
-            case BMI090L_GYRO_INT_FIFO_WM:
-            case BMI090L_GYRO_INT_FIFO_FULL:
+        while ((rslt == BMI090L_OK) && (read < count))
+        {
+            rslt = get_regs(BMI090L_REG_GYRO_INT_STAT_1, &status, 1, dev);
 
-                /* FIFO interrupt */
-                rslt = set_fifo_int(int_config, dev);
-                break;
+            if ((rslt == BMI090L_OK) && ((status & BMI090L_GYRO_DATA_READY_INT) != 0))
+            {
+                /* Timestamp when data ready was seen */
+                if (ring->time_us != NULL)
+                {
+                    time_us = dev->timestamp_us(dev->intf_ptr_gyro);
+                }
 
-            default:
-                rslt = BMI090L_E_INVALID_CONFIG;
-                break;
+                rslt = get_regs(BMI090L_REG_GYRO_X_LSB, data, 6, dev);
+
+                if (rslt == BMI090L_OK)
+                {
+                    sample.x = (int16_t)((uint16_t)(data[1] << 8) | data[0]); /* Data in X axis */
+                    sample.y = (int16_t)((uint16_t)(data[3] << 8) | data[2]); /* Data in Y axis */
+                    sample.z = (int16_t)((uint16_t)(data[5] << 8) | data[4]); /* Data in Z axis */
+
+                    sample_ring_put(ring, &sample, time_us);
+                    read++;
+                    waited = 0;
+                }
+            }
+            else if (rslt == BMI090L_OK)
+            {
+                if (waited >= BMI090L_SAMPLE_TIMEOUT_US)
+                {
+                    /* No new sample, hand out what was read so far */
+                    rslt = BMI090L_W_PARTIAL_READ;
+                }
+                else
+                {
+                    dev->delay_us(BMI090L_SAMPLE_POLL_US, dev->intf_ptr_gyro);
+                    waited += BMI090L_SAMPLE_POLL_US;
+                }
+            }
         }
+
+        (*n_read) = read;
     }
     else
     {
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- *  @brief This API checks whether the self test functionality of the
- *  gyro sensor is working or not.
+ *  @brief This API converts a batch of raw gyro samples to float.
  */
-int8_t bmi090lg_perform_selftest(struct bmi090l_dev *dev)
+int8_t bmi090lg_convert_data(const struct bmi090l_sensor_data *raw,
+                             struct bmi090l_sensor_data_f *data,
+                             uint16_t count,
+                             uint8_t unit,
+                             struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t data = 0, loop_break = 1;
+    uint16_t indx;
+    float scale;
 
     /* Check for null pointer in the device structure */
     rslt = null_ptr_check(dev);
 
     /* Proceed if null check is fine */
-    if (rslt == BMI090L_OK)
+    if ((rslt == BMI090L_OK) && (raw != NULL) && (data != NULL))
     {
-        /* Enable the gyro self-test */
-        rslt = set_gyro_selftest(BMI090L_ENABLE, dev);
+        if ((unit != BMI090L_UNIT_DPS) && (unit != BMI090L_UNIT_RPS))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+        else if (dev->gyro_cfg.range > BMI090L_GYRO_RANGE_125_DPS)
+        {
+            rslt = BMI090L_E_INVALID_CONFIG;
+        }
+        else
+        {
+            /* Scale per LSB, the full scale halves with every range step */
+            scale = (float)(BMI090L_GYRO_FULL_SCALE_DPS >> dev->gyro_cfg.range) / (float)BMI090L_HALF_SCALE;
+            if (unit == BMI090L_UNIT_RPS)
+            {
+                scale *= BMI090L_DEG_TO_RAD;
+            }
+
+            /* One multiply per value and no branch, the loop is left to the compiler to vectorize */
+            for (indx = 0; indx < count; indx++)
+            {
+                data[indx].x = (float)raw[indx].x * scale;
+                data[indx].y = (float)raw[indx].y * scale;
+                data[indx].z = (float)raw[indx].z * scale;
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API converts a batch of raw gyro samples to Q16.16 fixed point.
+ */
+int8_t bmi090lg_convert_data_q16(const struct bmi090l_sensor_data *raw,
+                                 struct bmi090l_sensor_data_q16 *data,
+                                 uint16_t count,
+                                 uint8_t unit,
+                                 struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint16_t indx;
+    int32_t scale;
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (raw != NULL) && (data != NULL))
+    {
+        if ((unit != BMI090L_UNIT_DPS) && (unit != BMI090L_UNIT_RPS))
+        {
+            rslt = BMI090L_E_INVALID_INPUT;
+        }
+        else if (dev->gyro_cfg.range > BMI090L_GYRO_RANGE_125_DPS)
+        {
+            rslt = BMI090L_E_INVALID_CONFIG;
+        }
+        else
+        {
+            /* Full scale of the configured range in Q16.16 */
+            scale = (unit == BMI090L_UNIT_DPS) ? (BMI090L_GYRO_FULL_SCALE_DPS << 16) : BMI090L_GYRO_FULL_SCALE_RPS_Q16;
+            scale = scale >> dev->gyro_cfg.range;
+
+            for (indx = 0; indx < count; indx++)
+            {
+                data[indx].x = (int32_t)(((int64_t)raw[indx].x * scale) / BMI090L_HALF_SCALE);
+                data[indx].y = (int32_t)(((int64_t)raw[indx].y * scale) / BMI090L_HALF_SCALE);
+                data[indx].z = (int32_t)(((int64_t)raw[indx].z * scale) / BMI090L_HALF_SCALE);
+            }
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API configures the necessary gyro interrupt
+ * based on the user settings in the bmi090l_int_cfg
+ * structure instance.
+ */
+int8_t bmi090lg_set_int_config(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SET_INT_CONFIG);
+
+    /* Check for null pointer in the device structure*/
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if ((rslt == BMI090L_OK) && (int_config != NULL))
+    {
+        switch (int_config->int_type)
+        {
+            case BMI090L_GYRO_INT_DATA_RDY:
+
+                /* Data ready interrupt */
+                rslt = set_gyro_data_ready_int(int_config, dev);
+                break;
+            case BMI090L_GYRO_INT_FIFO_WM:
+            case BMI090L_GYRO_INT_FIFO_FULL:
+
+                /* FIFO interrupt */
+                rslt = set_fifo_int(int_config, dev);
+                break;
+
+            default:
+                rslt = BMI090L_E_INVALID_CONFIG;
+                break;
+        }
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*!
+ *  @brief This API checks whether the self test functionality of the
+ *  gyro sensor is working or not.
+ */
+int8_t bmi090lg_perform_selftest(struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t data = 0, loop_break = 1;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_PERFORM_SELFTEST);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    /* Proceed if null check is fine */
+    if (rslt == BMI090L_OK)
+    {
+        /* Enable the gyro self-test */
+        rslt = set_gyro_selftest(BMI090L_ENABLE, dev);
 
         if (rslt == BMI090L_OK)
         {
@@ -684,6 +1282,8 @@ int8_t bmi090lg_perform_selftest(struct bmi090l_dev *dev)
         }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -695,6 +1295,8 @@ int8_t bmi090lg_get_data_int_status(uint8_t *int_status, struct bmi090l_dev *dev
     int8_t rslt;
     uint8_t status = 0;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_DATA_INT_STATUS);
+
     if (int_status != NULL)
     {
         rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_INT_STAT_1, &status, 1, dev);
@@ -708,6 +1310,8 @@ int8_t bmi090lg_get_data_int_status(uint8_t *int_status, struct bmi090l_dev *dev
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -719,6 +1323,8 @@ int8_t bmi090lg_get_fifo_overrun(uint8_t *fifo_overrun, struct bmi090l_dev *dev)
     int8_t rslt;
     uint8_t reg_data = 0;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_FIFO_OVERRUN);
+
     if (fifo_overrun != NULL)
     {
         rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_STATUS, &reg_data, 1, dev);
@@ -733,6 +1339,8 @@ int8_t bmi090lg_get_fifo_overrun(uint8_t *fifo_overrun, struct bmi090l_dev *dev)
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -744,27 +1352,37 @@ int8_t bmi090lg_get_fifo_config(struct bmi090l_gyr_fifo_config *fifo_conf, struc
     int8_t rslt;
     uint8_t fifo_config[2] = { 0 };
     uint8_t reg_data = 0;
+    struct bmi090l_xfer_seg seg[2];
 
-    if (fifo_conf != NULL)
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_GET_FIFO_CONFIG);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && (fifo_conf != NULL))
     {
-        rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_CONFIG0, fifo_config, 2, dev);
+        /* Read FIFO configuration and status in one batch */
+        seg[0].reg_addr = BMI090L_REG_GYRO_FIFO_CONFIG0;
+        seg[0].dir = BMI090L_XFER_READ;
+        seg[0].data = fifo_config;
+        seg[0].len = 2;
+        seg[1].reg_addr = BMI090L_REG_GYRO_FIFO_STATUS;
+        seg[1].dir = BMI090L_XFER_READ;
+        seg[1].data = &reg_data;
+        seg[1].len = 1;
+        rslt = xfer_regs(seg, 2, dev);
 
         if (rslt == BMI090L_OK)
         {
-            rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_STATUS, &reg_data, 1, dev);
-
-            if (rslt == BMI090L_OK)
-            {
-                fifo_conf->tag = BMI090L_GET_BITS(fifo_config[0], BMI090L_GYRO_FIFO_TAG);
+            fifo_conf->tag = BMI090L_GET_BITS(fifo_config[0], BMI090L_GYRO_FIFO_TAG);
 
-                fifo_conf->wm_level = BMI090L_GET_BITS_POS_0(fifo_config[0], BMI090L_GYRO_FIFO_WM_LEVEL);
+            fifo_conf->wm_level = BMI090L_GET_BITS_POS_0(fifo_config[0], BMI090L_GYRO_FIFO_WM_LEVEL);
 
-                fifo_conf->mode = BMI090L_GET_BITS(fifo_config[1], BMI090L_GYRO_FIFO_MODE);
+            fifo_conf->mode = BMI090L_GET_BITS(fifo_config[1], BMI090L_GYRO_FIFO_MODE);
 
-                fifo_conf->data_select = BMI090L_GET_BITS_POS_0(fifo_config[1], BMI090L_GYRO_FIFO_DATA_SELECT);
+            fifo_conf->data_select = BMI090L_GET_BITS_POS_0(fifo_config[1], BMI090L_GYRO_FIFO_DATA_SELECT);
 
-                fifo_conf->frame_count = BMI090L_GET_BITS_POS_0(reg_data, BMI090L_GYRO_FIFO_FRAME_COUNT);
-            }
+            fifo_conf->frame_count = BMI090L_GET_BITS_POS_0(reg_data, BMI090L_GYRO_FIFO_FRAME_COUNT);
         }
     }
     else
@@ -772,6 +1390,8 @@ int8_t bmi090lg_get_fifo_config(struct bmi090l_gyr_fifo_config *fifo_conf, struc
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -783,6 +1403,8 @@ int8_t bmi090lg_set_fifo_config(const struct bmi090l_gyr_fifo_config *fifo_conf,
     int8_t rslt;
     uint8_t fifo_config[2] = { 0 };
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_SET_FIFO_CONFIG);
+
     if (fifo_conf != NULL)
     {
         rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_CONFIG0, fifo_config, 2, dev);
@@ -807,6 +1429,8 @@ int8_t bmi090lg_set_fifo_config(const struct bmi090l_gyr_fifo_config *fifo_conf,
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
@@ -847,6 +1471,8 @@ int8_t bmi090lg_read_fifo_data(const struct bmi090l_fifo_frame *fifo, struct bmi
 {
     int8_t rslt = BMI090L_OK;
 
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_READ_FIFO_DATA);
+
     if (fifo != NULL)
     {
         rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_DATA, fifo->data, fifo->length, dev);
@@ -856,129 +1482,369 @@ int8_t bmi090lg_read_fifo_data(const struct bmi090l_fifo_frame *fifo, struct bmi
         rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- *  @brief This API is used to extract gyroscope data from fifo.
+ * @brief This API drains the gyro FIFO, sized from the FIFO status.
  */
-void bmi090lg_extract_gyro(struct bmi090l_sensor_data *gyro_data,
-                           const uint16_t *gyro_length,
-                           const struct bmi090l_gyr_fifo_config *fifo_conf,
-                           const struct bmi090l_fifo_frame *fifo)
+int8_t bmi090lg_drain_fifo(struct bmi090l_fifo_frame *fifo,
+                           struct bmi090l_gyr_fifo_config *fifo_conf,
+                           uint8_t *fifo_overrun,
+                           struct bmi090l_dev *dev)
 {
-    uint16_t data_index = 0;
-    uint16_t gyro_index = 0;
-    uint16_t data_read_length = 0;
+    int8_t rslt;
+    uint8_t fifo_config[2] = { 0 };
+    uint8_t reg_data = 0;
+    uint8_t frame_size;
+    uint8_t partial = FALSE;
+    uint16_t frames;
+    struct bmi090l_xfer_seg seg[2];
 
-    /* Get the number of gyro bytes to be read */
-    parse_fifo_gyro_len(&data_read_length, gyro_length, fifo_conf, fifo);
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
 
-    for (; data_index < data_read_length;)
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_DRAIN_FIFO);
+
+    if ((rslt == BMI090L_OK) && (fifo != NULL) && (fifo->data != NULL) && (fifo_conf != NULL) &&
+        (fifo_overrun != NULL))
     {
-        unpack_gyro_data(&gyro_data[gyro_index], &data_index, fifo_conf, fifo);
-        gyro_index++;
-    }
-}
+        /* The configuration is answered from the shadow cache when enabled */
+        seg[0].reg_addr = BMI090L_REG_GYRO_FIFO_CONFIG0;
+        seg[0].dir = BMI090L_XFER_READ;
+        seg[0].data = fifo_config;
+        seg[0].len = 2;
+        seg[1].reg_addr = BMI090L_REG_GYRO_FIFO_STATUS;
+        seg[1].dir = BMI090L_XFER_READ;
+        seg[1].data = &reg_data;
+        seg[1].len = 1;
+        rslt = xfer_regs(seg, 2, dev);
 
-/*
- * @brief This API is used to set fifo watermark enable/disable
- * in the register 0x1E bit 7
- */
-int8_t bmi090lg_enable_watermark(uint8_t enable, struct bmi090l_dev *dev)
-{
-    int8_t rslt;
-    uint8_t reg_data;
+        if (rslt == BMI090L_OK)
+        {
+            fifo_conf->tag = BMI090L_GET_BITS(fifo_config[0], BMI090L_GYRO_FIFO_TAG);
+            fifo_conf->wm_level = BMI090L_GET_BITS_POS_0(fifo_config[0], BMI090L_GYRO_FIFO_WM_LEVEL);
+            fifo_conf->mode = BMI090L_GET_BITS(fifo_config[1], BMI090L_GYRO_FIFO_MODE);
+            fifo_conf->data_select = BMI090L_GET_BITS_POS_0(fifo_config[1], BMI090L_GYRO_FIFO_DATA_SELECT);
+            *fifo_overrun = BMI090L_GET_BITS(reg_data, BMI090L_GYRO_FIFO_OVERRUN);
 
-    if (enable)
-    {
-        reg_data = BMI090L_GYRO_FIFO_WM_ENABLE_VAL;
-        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_FIFO_WM_ENABLE, &reg_data, 1, dev);
+            frame_size = (fifo_conf->data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED) ?
+                         BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE : BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE;
+            if (fifo_conf->tag)
+            {
+                frame_size += 2;
+            }
+
+            /* Frames which do not fit are left in the FIFO for the next drain */
+            frames = BMI090L_GET_BITS_POS_0(reg_data, BMI090L_GYRO_FIFO_FRAME_COUNT);
+            if (frames > (fifo->length / frame_size))
+            {
+                frames = fifo->length / frame_size;
+                partial = TRUE;
+            }
+
+            fifo_conf->frame_count = (uint8_t)frames;
+            fifo->length = (uint16_t)(frames * frame_size);
+
+            if (frames > 0)
+            {
+                rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_FIFO_DATA, fifo->data, fifo->length, dev);
+            }
+
+            if ((rslt == BMI090L_OK) && partial)
+            {
+                rslt = BMI090L_W_PARTIAL_READ;
+            }
+            else if ((rslt == BMI090L_OK) && (frames == 0))
+            {
+                rslt = BMI090L_W_FIFO_EMPTY;
+            }
+        }
     }
     else
     {
-        reg_data = BMI090L_GYRO_FIFO_WM_DISABLE_VAL;
-        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_FIFO_WM_ENABLE, &reg_data, 1, dev);
+        rslt = BMI090L_E_NULL_PTR;
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
-/*****************************************************************************/
-/* Static function definition */
-
-/*! @cond DOXYGEN_SUPRESS */
-
-/* Suppressing doxygen warnings triggered for same static function names present across various sensor variant
- * directories */
-
 /*!
- * @brief This API is used to validate the device structure pointer for
- * null conditions.
+ * @brief This API starts a non-blocking read of the FIFO data.
  */
-static int8_t null_ptr_check(const struct bmi090l_dev *dev)
+int8_t bmi090lg_fifo_read_start(struct bmi090l_fifo_xfer *xfer, struct bmi090l_dev *dev)
 {
     int8_t rslt;
+    uint8_t reg_addr = BMI090L_REG_GYRO_FIFO_DATA;
 
-    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL) ||
-        (dev->intf_ptr_accel == NULL) || (dev->intf_ptr_gyro == NULL))
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_FIFO_READ_START);
+
+    /* Check for null pointer in the device structure */
+    rslt = null_ptr_check(dev);
+
+    if ((rslt == BMI090L_OK) && ((xfer == NULL) || (xfer->fifo == NULL) || (xfer->fifo->data == NULL) ||
+                                 (dev->read_async == NULL)))
     {
-        /* Device structure pointer is not valid */
         rslt = BMI090L_E_NULL_PTR;
     }
-    else
+    else if ((rslt == BMI090L_OK) && (xfer->busy))
     {
-        /* Device structure is fine */
-        rslt = BMI090L_OK;
+        rslt = BMI090L_E_BUSY;
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        xfer->dev = dev;
+        xfer->busy = TRUE;
+
+        if (dev->intf == BMI090L_SPI_INTF)
+        {
+            /* Configuring reg_addr for SPI Interface */
+            reg_addr = (reg_addr | BMI090L_SPI_RD_MASK);
+        }
+
+        /* Completion may already be reported from inside the call */
+        BMI090L_STATS_BUS(dev, BMI090L_XFER_READ, xfer->fifo->length);
+        dev->intf_rslt = dev->read_async(reg_addr, xfer->fifo->data, xfer->fifo->length, dev->intf_ptr_gyro, xfer);
+
+        if (dev->intf_rslt != BMI090L_INTF_RET_SUCCESS)
+        {
+            xfer->busy = FALSE;
+            rslt = BMI090L_E_COM_FAIL;
+        }
     }
 
+    BMI090L_STATS_EXIT(dev);
+
     return rslt;
 }
 
 /*!
- * @brief This API reads the data from the given register address of gyro sensor.
+ * @brief This API finishes a non-blocking read of the FIFO data.
  */
-static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+int8_t bmi090lg_fifo_read_complete(struct bmi090l_fifo_xfer *xfer, BMI090L_INTF_RET_TYPE intf_rslt)
 {
     int8_t rslt = BMI090L_OK;
 
-    if (dev->intf == BMI090L_SPI_INTF)
+    if ((xfer == NULL) || (xfer->dev == NULL))
     {
-        /* Configuring reg_addr for SPI Interface */
-        reg_addr = (reg_addr | BMI090L_SPI_RD_MASK);
+        rslt = BMI090L_E_NULL_PTR;
     }
+    else
+    {
+        if (intf_rslt != BMI090L_INTF_RET_SUCCESS)
+        {
+            rslt = BMI090L_E_COM_FAIL;
+        }
 
-    /* Read gyro register */
-    dev->intf_rslt = dev->read(reg_addr, reg_data, len, dev->intf_ptr_gyro);
+        xfer->dev->intf_rslt = intf_rslt;
+        xfer->rslt = rslt;
+        xfer->busy = FALSE;
 
-    if (dev->intf_rslt != BMI090L_INTF_RET_SUCCESS)
-    {
-        /* Updating the error */
-        rslt = BMI090L_E_COM_FAIL;
+        if (xfer->done != NULL)
+        {
+            xfer->done(xfer, rslt);
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API writes the given data to the register address of gyro sensor.
+ *  @brief This API is used to extract gyroscope data from fifo.
  */
-static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+void bmi090lg_extract_gyro(struct bmi090l_sensor_data *gyro_data,
+                           const uint16_t *gyro_length,
+                           const struct bmi090l_gyr_fifo_config *fifo_conf,
+                           const struct bmi090l_fifo_frame *fifo)
 {
-    int8_t rslt = BMI090L_OK;
-    uint32_t count = 0;
+    uint16_t data_index = 0;
+    uint16_t gyro_index = 0;
+    uint16_t data_read_length = 0;
 
-    if (dev->intf == BMI090L_SPI_INTF)
-    {
-        /* Configuring reg_addr for SPI Interface */
-        reg_addr = (reg_addr & BMI090L_SPI_WR_MASK);
-    }
+    /* Get the number of gyro bytes to be read */
+    parse_fifo_gyro_len(&data_read_length, gyro_length, fifo_conf, fifo);
+
+    for (; data_index < data_read_length;)
+    {
+        unpack_gyro_data(&gyro_data[gyro_index], &data_index, fifo_conf, fifo);
+        gyro_index++;
+    }
+}
+
+/*!
+ *  @brief This API extracts gyroscope FIFO frames into a packed array.
+ */
+int8_t bmi090lg_extract_gyro_packed(int16_t *gyro_data,
+                                    uint16_t *tag,
+                                    uint16_t *frame_count,
+                                    const struct bmi090l_gyr_fifo_config *fifo_conf,
+                                    const struct bmi090l_fifo_frame *fifo)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t frame_size;
+    uint16_t count;
+
+    if ((gyro_data != NULL) && (frame_count != NULL) && (fifo_conf != NULL) && (fifo != NULL) &&
+        (fifo->data != NULL))
+    {
+        frame_size = (fifo_conf->data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED) ?
+                     BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE : BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE;
+        if (fifo_conf->tag)
+        {
+            frame_size += 2;
+        }
+        else
+        {
+            /* Untagged frames have no tag to return */
+            tag = NULL;
+        }
+
+        count = fifo->length / frame_size;
+        if (count > (*frame_count))
+        {
+            count = *frame_count;
+            rslt = BMI090L_W_PARTIAL_READ;
+        }
+
+        /* The layout is fixed for the whole buffer, select the loop once */
+        if (fifo_conf->data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
+        {
+            unpack_gyro_xyz(gyro_data, tag, count, fifo->data);
+        }
+        else
+        {
+            unpack_gyro_axis(gyro_data, tag, count, fifo->data);
+        }
+
+        *frame_count = count;
+    }
+    else
+    {
+        rslt = BMI090L_E_NULL_PTR;
+    }
+
+    return rslt;
+}
+
+/*
+ * @brief This API is used to set fifo watermark enable/disable
+ * in the register 0x1E bit 7
+ */
+int8_t bmi090lg_enable_watermark(uint8_t enable, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    uint8_t reg_data;
+
+    BMI090L_STATS_ENTER(dev, BMI090L_STATS_API_BMI090LG_ENABLE_WATERMARK);
+
+    if (enable)
+    {
+        reg_data = BMI090L_GYRO_FIFO_WM_ENABLE_VAL;
+        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_FIFO_WM_ENABLE, &reg_data, 1, dev);
+    }
+    else
+    {
+        reg_data = BMI090L_GYRO_FIFO_WM_DISABLE_VAL;
+        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_FIFO_WM_ENABLE, &reg_data, 1, dev);
+    }
+
+    BMI090L_STATS_EXIT(dev);
+
+    return rslt;
+}
+
+/*****************************************************************************/
+/* Static function definition */
+
+/*! @cond DOXYGEN_SUPRESS */
+
+/* Suppressing doxygen warnings triggered for same static function names present across various sensor variant
+ * directories */
+
+/*!
+ * @brief This API is used to validate the device structure pointer for
+ * null conditions.
+ */
+static int8_t null_ptr_check(const struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    if ((dev == NULL) || (dev->read == NULL) || (dev->write == NULL) || (dev->delay_us == NULL) ||
+        (dev->intf_ptr_accel == NULL) || (dev->intf_ptr_gyro == NULL))
+    {
+        /* Device structure pointer is not valid */
+        rslt = BMI090L_E_NULL_PTR;
+    }
+    else
+    {
+        /* Device structure is fine */
+        rslt = BMI090L_OK;
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API reads the data from the given register address of gyro sensor.
+ */
+static int8_t get_regs(uint8_t reg_addr, uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t addr = reg_addr;
+
+    /* Configuration registers are answered from the shadow cache when known */
+    if (!shadow_get(reg_addr, reg_data, len, dev))
+    {
+        if (dev->intf == BMI090L_SPI_INTF)
+        {
+            /* Configuring reg_addr for SPI Interface */
+            addr = (reg_addr | BMI090L_SPI_RD_MASK);
+        }
+
+        /* Read gyro register */
+        BMI090L_STATS_BUS(dev, BMI090L_XFER_READ, len);
+        dev->intf_rslt = dev->read(addr, reg_data, len, dev->intf_ptr_gyro);
+
+        if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+        {
+            shadow_store(reg_addr, reg_data, len, BMI090L_XFER_READ, dev);
+        }
+        else
+        {
+            /* Updating the error */
+            rslt = BMI090L_E_COM_FAIL;
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API writes the given data to the register address of gyro sensor.
+ */
+static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint32_t count = 0;
+    uint8_t plain_addr = reg_addr;
+
+    if (dev->intf == BMI090L_SPI_INTF)
+    {
+        /* Configuring reg_addr for SPI Interface */
+        reg_addr = (reg_addr & BMI090L_SPI_WR_MASK);
+    }
 
     /* SPI write requires to set The MSB of reg_addr as 0
      * but in default the MSB is always 0
      */
     if (len == 1)
     {
+        BMI090L_STATS_BUS(dev, BMI090L_XFER_WRITE, len);
         dev->intf_rslt = dev->write(reg_addr, reg_data, len, dev->intf_ptr_gyro);
 
         if (dev->intf_rslt != BMI090L_INTF_RET_SUCCESS)
@@ -996,6 +1862,7 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
     {
         for (count = 0; count < len; count++)
         {
+            BMI090L_STATS_BUS(dev, BMI090L_XFER_WRITE, 1);
             dev->intf_rslt = dev->write(reg_addr, &reg_data[count], 1, dev->intf_ptr_gyro);
 
             reg_addr++;
@@ -1009,6 +1876,16 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
         }
     }
 
+    if (rslt == BMI090L_OK)
+    {
+        shadow_store(plain_addr, reg_data, len, BMI090L_XFER_WRITE, dev);
+    }
+    else
+    {
+        /* Register state is unknown, drop the shadow cache */
+        dev->shadow.gyro_valid = 0;
+    }
+
     return rslt;
 }
 
@@ -1018,10 +1895,10 @@ static int8_t set_regs(uint8_t reg_addr, const uint8_t *reg_data, uint32_t len,
 static int8_t set_gyro_data_ready_int(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t conf, data[2] = { 0 };
+    uint8_t conf, data[3] = { 0 };
 
-    /* read interrupt map register */
-    rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_INT3_INT4_IO_MAP, &data[0], 1, dev);
+    /* Read interrupt map and interrupt pin configuration registers */
+    rslt = int_regs_xfer(BMI090L_XFER_READ, data, 2, dev);
 
     if (rslt == BMI090L_OK)
     {
@@ -1048,33 +1925,23 @@ static int8_t set_gyro_data_ready_int(const struct bmi090l_gyro_int_channel_cfg
 
         if (rslt == BMI090L_OK)
         {
-            /*condition to check disabling the interrupt in single channel when both
+            /* Condition to check disabling the interrupt in single channel when both
              * interrupts channels are enabled*/
             if (data[0] & BMI090L_GYRO_MAP_DRDY_TO_BOTH_INT3_INT4)
             {
-                /* Updating the data */
                 /* Data to enable new data ready interrupt */
-                data[1] = BMI090L_GYRO_DRDY_INT_ENABLE_VAL;
+                data[2] = BMI090L_GYRO_DRDY_INT_ENABLE_VAL;
             }
             else
             {
-                data[1] = BMI090L_GYRO_DRDY_INT_DISABLE_VAL;
+                data[2] = BMI090L_GYRO_DRDY_INT_DISABLE_VAL;
             }
 
-            /* Write data to interrupt map register */
-            rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_INT3_INT4_IO_MAP, &data[0], 1, dev);
-
-            if (rslt == BMI090L_OK)
-            {
-                /* Configure interrupt pin */
-                rslt = set_int_pin_config(int_config, dev);
+            /* Configure interrupt pin */
+            data[1] = get_int_pin_conf(int_config, data[1]);
 
-                if (rslt == BMI090L_OK)
-                {
-                    /* Write data to interrupt control register */
-                    rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_INT_CTRL, &data[1], 1, dev);
-                }
-            }
+            /* Write interrupt map, pin configuration and interrupt control registers */
+            rslt = int_regs_xfer(BMI090L_XFER_WRITE, data, 3, dev);
         }
     }
 
@@ -1087,10 +1954,10 @@ static int8_t set_gyro_data_ready_int(const struct bmi090l_gyro_int_channel_cfg
 static int8_t set_fifo_int(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev)
 {
     int8_t rslt;
-    uint8_t conf, data[2] = { 0 };
+    uint8_t conf, data[3] = { 0 };
 
-    /* Read interrupt map register */
-    rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_INT3_INT4_IO_MAP, &data[0], 1, dev);
+    /* Read interrupt map and interrupt pin configuration registers */
+    rslt = int_regs_xfer(BMI090L_XFER_READ, data, 2, dev);
 
     if (rslt == BMI090L_OK)
     {
@@ -1100,13 +1967,13 @@ static int8_t set_fifo_int(const struct bmi090l_gyro_int_channel_cfg *int_config
         {
             case BMI090L_INT_CHANNEL_3:
 
-                /* Data to enable new data ready interrupt */
+                /* Data to enable FIFO interrupt */
                 data[0] = BMI090L_SET_BITS_POS_0(data[0], BMI090L_GYRO_FIFO_INT3, conf);
                 break;
 
             case BMI090L_INT_CHANNEL_4:
 
-                /* Data to enable new data ready interrupt */
+                /* Data to enable FIFO interrupt */
                 data[0] = BMI090L_SET_BITS(data[0], BMI090L_GYRO_FIFO_INT4, conf);
                 break;
 
@@ -1121,77 +1988,516 @@ static int8_t set_fifo_int(const struct bmi090l_gyro_int_channel_cfg *int_config
              * interrupts channels are enabled*/
             if (data[0] & BMI090L_GYRO_MAP_DRDY_TO_BOTH_INT3_INT4)
             {
-                /* Updating the data */
-                /* Data to enable new data ready interrupt */
-                data[1] = BMI090L_GYRO_FIFO_INT_ENABLE_VAL;
+                /* Data to enable FIFO interrupt */
+                data[2] = BMI090L_GYRO_FIFO_INT_ENABLE_VAL;
             }
             else
             {
-                data[1] = BMI090L_GYRO_FIFO_INT_ENABLE_VAL;
+                data[2] = BMI090L_GYRO_FIFO_INT_ENABLE_VAL;
             }
 
-            /* Write data to interrupt map register */
-            rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_INT3_INT4_IO_MAP, &data[0], 1, dev);
+            /* Configure interrupt pin */
+            data[1] = get_int_pin_conf(int_config, data[1]);
 
-            if (rslt == BMI090L_OK)
+            /* Write interrupt map, pin configuration and interrupt control registers */
+            rslt = int_regs_xfer(BMI090L_XFER_WRITE, data, 3, dev);
+        }
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API updates the interrupt pin configuration register value
+ * with the user settings.
+ */
+static uint8_t get_int_pin_conf(const struct bmi090l_gyro_int_channel_cfg *int_config, uint8_t data)
+{
+    switch (int_config->int_channel)
+    {
+        /* Interrupt pin or channel 3 */
+        case BMI090L_INT_CHANNEL_3:
+
+            /* Update data with user configured bmi090l_int_cfg structure */
+            data = BMI090L_SET_BITS_POS_0(data, BMI090L_GYRO_INT3_LVL, int_config->int_pin_cfg.lvl);
+            data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT3_OD, int_config->int_pin_cfg.output_mode);
+            break;
+
+        case BMI090L_INT_CHANNEL_4:
+
+            /* Update data with user configured bmi090l_int_cfg structure */
+            data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT4_LVL, int_config->int_pin_cfg.lvl);
+            data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT4_OD, int_config->int_pin_cfg.output_mode);
+            break;
+
+        default:
+            break;
+    }
+
+    return data;
+}
+
+/*!
+ * @brief This API reads or writes the interrupt map, interrupt pin
+ * configuration and interrupt control registers in one batch.
+ */
+static int8_t int_regs_xfer(uint8_t dir, uint8_t *data, uint8_t count, struct bmi090l_dev *dev)
+{
+    struct bmi090l_xfer_seg seg[3];
+    const uint8_t reg_addr[3] = {
+        BMI090L_REG_GYRO_INT3_INT4_IO_MAP, BMI090L_REG_GYRO_INT3_INT4_IO_CONF, BMI090L_REG_GYRO_INT_CTRL
+    };
+    uint8_t indx;
+
+    for (indx = 0; indx < count; indx++)
+    {
+        seg[indx].reg_addr = reg_addr[indx];
+        seg[indx].dir = dir;
+        seg[indx].data = &data[indx];
+        seg[indx].len = 1;
+    }
+
+    return xfer_regs(seg, count, dev);
+}
+
+/*!
+ * @brief This API performs a list of register transactions, answering leading
+ * reads from the shadow cache.
+ */
+static int8_t xfer_regs(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    struct bmi090l_xfer_seg pending[BMI090L_XFER_MAX_SEGS];
+    uint8_t pending_count = 0;
+    uint8_t write_seen = FALSE;
+    uint8_t indx;
+
+    if (dev->shadow.enable && (count <= BMI090L_XFER_MAX_SEGS))
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            /* Reads behind a write of the same batch must see the sensor */
+            if (seg[indx].dir == BMI090L_XFER_WRITE)
             {
-                /* Configure interrupt pin */
-                rslt = set_int_pin_config(int_config, dev);
+                write_seen = TRUE;
+            }
 
-                if (rslt == BMI090L_OK)
+            if (write_seen || !shadow_get(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev))
+            {
+                pending[pending_count++] = seg[indx];
+            }
+        }
+
+        if (pending_count > 0)
+        {
+            rslt = xfer_regs_bus(pending, pending_count, dev);
+        }
+    }
+    else
+    {
+        rslt = xfer_regs_bus(seg, count, dev);
+    }
+
+    return rslt;
+}
+
+/*!
+ * @brief This API performs a list of register transactions, through the
+ * vectored interface when available.
+ */
+static int8_t xfer_regs_bus(struct bmi090l_xfer_seg *seg, uint8_t count, struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    struct bmi090l_xfer_seg wire[BMI090L_XFER_MAX_SEGS];
+    uint8_t wire_count = 0;
+    uint8_t indx;
+    uint32_t byte;
+
+    /* Burst write is not allowed, multi byte writes take one segment per byte */
+    for (indx = 0; (indx < count) && (dev->xfer != NULL) && (wire_count <= BMI090L_XFER_MAX_SEGS); indx++)
+    {
+        if (seg[indx].dir == BMI090L_XFER_READ)
+        {
+            wire_count++;
+        }
+        else
+        {
+            wire_count += (uint8_t)((seg[indx].len < BMI090L_XFER_MAX_SEGS) ? seg[indx].len : BMI090L_XFER_MAX_SEGS);
+        }
+    }
+
+    /* An empty list does not reach the vectored interface */
+    if ((dev->xfer != NULL) && (wire_count > 0) && (wire_count <= BMI090L_XFER_MAX_SEGS))
+    {
+        wire_count = 0;
+        for (indx = 0; indx < count; indx++)
+        {
+            if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                wire[wire_count] = seg[indx];
+
+                if (dev->intf == BMI090L_SPI_INTF)
+                {
+                    /* Configuring reg_addr for SPI Interface */
+                    wire[wire_count].reg_addr = seg[indx].reg_addr | BMI090L_SPI_RD_MASK;
+                }
+
+                wire_count++;
+            }
+            else
+            {
+                for (byte = 0; byte < seg[indx].len; byte++)
                 {
-                    /* Write data to interrupt control register */
-                    rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_INT_CTRL, &data[1], 1, dev);
+                    /* SPI write requires the MSB of reg_addr to be 0, which it is by default */
+                    wire[wire_count].reg_addr = (uint8_t)((seg[indx].reg_addr + byte) & BMI090L_SPI_WR_MASK);
+                    wire[wire_count].dir = BMI090L_XFER_WRITE;
+                    wire[wire_count].data = &seg[indx].data[byte];
+                    wire[wire_count].len = 1;
+                    wire_count++;
                 }
             }
         }
+
+        BMI090L_STATS_XFER(dev, wire, wire_count);
+
+        dev->intf_rslt = dev->xfer(wire, wire_count, dev->intf_ptr_gyro);
+
+        if (dev->intf_rslt == BMI090L_INTF_RET_SUCCESS)
+        {
+            for (indx = 0; indx < count; indx++)
+            {
+                shadow_store(seg[indx].reg_addr, seg[indx].data, seg[indx].len, seg[indx].dir, dev);
+            }
+        }
+        else
+        {
+            /* Register state is unknown, drop the shadow cache */
+            dev->shadow.gyro_valid = 0;
+
+            /* Failure case */
+            rslt = BMI090L_E_COM_FAIL;
+        }
+    }
+    else
+    {
+        for (indx = 0; (indx < count) && (rslt == BMI090L_OK); indx++)
+        {
+            if (seg[indx].dir == BMI090L_XFER_READ)
+            {
+                rslt = get_regs(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev);
+            }
+            else
+            {
+                rslt = set_regs(seg[indx].reg_addr, seg[indx].data, seg[indx].len, dev);
+            }
+        }
     }
 
     return rslt;
 }
 
 /*!
- * @brief This API configures the pins which fire the
- * interrupt signal when any interrupt occurs.
+ * @brief This API returns the shadow cache index of a register.
  */
-static int8_t set_int_pin_config(const struct bmi090l_gyro_int_channel_cfg *int_config, struct bmi090l_dev *dev)
+static uint8_t shadow_index(uint8_t reg_addr)
 {
-    int8_t rslt;
-    uint8_t data;
+    static const uint8_t shadow_reg[BMI090L_SHADOW_GYRO_LEN] = {
+        BMI090L_REG_GYRO_RANGE, BMI090L_REG_GYRO_BANDWIDTH, BMI090L_REG_GYRO_LPM1, BMI090L_REG_GYRO_INT_CTRL,
+        BMI090L_REG_GYRO_INT3_INT4_IO_CONF, BMI090L_REG_GYRO_INT3_INT4_IO_MAP, BMI090L_REG_GYRO_FIFO_WM_ENABLE,
+        BMI090L_REG_GYRO_FIFO_CONFIG0, BMI090L_REG_GYRO_FIFO_CONFIG1
+    };
+    uint8_t indx = 0;
+
+    while ((indx < BMI090L_SHADOW_GYRO_LEN) && (shadow_reg[indx] != reg_addr))
+    {
+        indx++;
+    }
 
-    /* Read interrupt configuration register */
-    rslt = bmi090lg_get_regs(BMI090L_REG_GYRO_INT3_INT4_IO_CONF, &data, 1, dev);
+    return indx;
+}
 
-    if (rslt == BMI090L_OK)
+/*!
+ * @brief This API answers a register read from the shadow cache.
+ */
+static uint8_t shadow_get(uint8_t reg_addr, uint8_t *data, uint32_t len, const struct bmi090l_dev *dev)
+{
+    uint8_t hit = FALSE;
+    uint8_t indx[BMI090L_SHADOW_GYRO_LEN];
+    uint32_t byte;
+
+    if (dev->shadow.enable && (len > 0) && (len <= BMI090L_SHADOW_GYRO_LEN))
     {
-        switch (int_config->int_channel)
+        hit = TRUE;
+        for (byte = 0; (byte < len) && hit; byte++)
         {
-            /* Interrupt pin or channel 3 */
-            case BMI090L_INT_CHANNEL_3:
+            indx[byte] = shadow_index((uint8_t)(reg_addr + byte));
+            hit = ((indx[byte] < BMI090L_SHADOW_GYRO_LEN) && (dev->shadow.gyro_valid & (1u << indx[byte])));
+        }
 
-                /* Update data with user configured bmi090l_int_cfg structure */
-                data = BMI090L_SET_BITS_POS_0(data, BMI090L_GYRO_INT3_LVL, int_config->int_pin_cfg.lvl);
-                data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT3_OD, int_config->int_pin_cfg.output_mode);
-                break;
+        for (byte = 0; (byte < len) && hit; byte++)
+        {
+            data[byte] = dev->shadow.gyro[indx[byte]];
+        }
+    }
 
-            case BMI090L_INT_CHANNEL_4:
+    return hit;
+}
 
-                /* Update data with user configured bmi090l_int_cfg structure */
-                data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT4_LVL, int_config->int_pin_cfg.lvl);
-                data = BMI090L_SET_BITS(data, BMI090L_GYRO_INT4_OD, int_config->int_pin_cfg.output_mode);
-                break;
+/*!
+ * @brief This API updates the shadow cache after a successful register read
+ * or write.
+ */
+static void shadow_store(uint8_t reg_addr, const uint8_t *data, uint32_t len, uint8_t dir, struct bmi090l_dev *dev)
+{
+    uint8_t indx;
+    uint32_t byte;
 
-            default:
-                break;
+    if (dev->shadow.enable)
+    {
+        if ((dir == BMI090L_XFER_WRITE) && (reg_addr == BMI090L_REG_GYRO_SOFTRESET) &&
+            (data[0] == BMI090L_SOFT_RESET_CMD))
+        {
+            dev->shadow.gyro_valid = 0;
+        }
+        else if (reg_addr == BMI090L_REG_GYRO_FIFO_DATA)
+        {
+            /* Burst access to the FIFO stays on the same address */
+        }
+        else if (len <= BMI090L_SHADOW_GYRO_LEN)
+        {
+            for (byte = 0; byte < len; byte++)
+            {
+                indx = shadow_index((uint8_t)(reg_addr + byte));
+                if (indx < BMI090L_SHADOW_GYRO_LEN)
+                {
+                    dev->shadow.gyro[indx] = data[byte];
+                    dev->shadow.gyro_valid |= (uint16_t)(1u << indx);
+                }
+            }
+
+            if (dir == BMI090L_XFER_WRITE)
+            {
+                for (byte = 0; byte < len; byte++)
+                {
+                    if ((reg_addr + byte) == BMI090L_REG_GYRO_BANDWIDTH)
+                    {
+                        /* Bit 7 of the bandwidth register always reads as set */
+                        dev->shadow.gyro[shadow_index(BMI090L_REG_GYRO_BANDWIDTH)] |= BMI090L_GYRO_ODR_RESET_VAL;
+                    }
+                    else if (((reg_addr + byte) == BMI090L_REG_GYRO_LPM1) &&
+                             (data[byte] == BMI090L_GYRO_PM_DEEP_SUSPEND))
+                    {
+                        /* Configuration is not retained in deep suspend */
+                        dev->shadow.gyro_valid = 0;
+                    }
+                }
+            }
+        }
+        else if (dir == BMI090L_XFER_WRITE)
+        {
+            /* Long writes are not tracked */
+            dev->shadow.gyro_valid = 0;
+        }
+    }
+}
+
+/*!
+ * @brief This API reads all cached registers into the shadow cache.
+ */
+static int8_t shadow_fill(struct bmi090l_dev *dev)
+{
+    int8_t rslt = BMI090L_OK;
+    uint8_t data[BMI090L_SHADOW_GYRO_LEN];
+    struct bmi090l_xfer_seg seg[5];
+    uint8_t indx;
+
+    if (dev->shadow.enable)
+    {
+        dev->shadow.gyro_valid = 0;
+
+        seg[0].reg_addr = BMI090L_REG_GYRO_RANGE;
+        seg[0].len = 3;
+        seg[1].reg_addr = BMI090L_REG_GYRO_INT_CTRL;
+        seg[1].len = 2;
+        seg[2].reg_addr = BMI090L_REG_GYRO_INT3_INT4_IO_MAP;
+        seg[2].len = 1;
+        seg[3].reg_addr = BMI090L_REG_GYRO_FIFO_WM_ENABLE;
+        seg[3].len = 1;
+        seg[4].reg_addr = BMI090L_REG_GYRO_FIFO_CONFIG0;
+        seg[4].len = 2;
+
+        for (indx = 0; indx < 5; indx++)
+        {
+            seg[indx].dir = BMI090L_XFER_READ;
+            seg[indx].data = &data[shadow_index(seg[indx].reg_addr)];
         }
 
-        /* Write to interrupt configuration register */
-        rslt = bmi090lg_set_regs(BMI090L_REG_GYRO_INT3_INT4_IO_CONF, &data, 1, dev);
+        /* The reads update the cache */
+        rslt = xfer_regs(seg, 5, dev);
     }
 
     return rslt;
 }
 
+/*!
+ * @brief This API waits until a masked gyro register reads the given value.
+ */
+static void wait_ready(uint8_t reg_addr, uint8_t mask, uint8_t value, uint32_t timeout_us, struct bmi090l_dev *dev)
+{
+    uint32_t waited = 0;
+    uint32_t backoff = BMI090L_POLL_BACKOFF_MIN_US;
+    uint8_t data = 0;
+    uint8_t ready = FALSE;
+
+    if (dev->wait_mode != BMI090L_WAIT_POLL)
+    {
+        dev->delay_us(timeout_us, dev->intf_ptr_gyro);
+    }
+    else
+    {
+        while (!ready && (waited < timeout_us))
+        {
+            if (backoff > (timeout_us - waited))
+            {
+                backoff = timeout_us - waited;
+            }
+
+            dev->delay_us(backoff, dev->intf_ptr_gyro);
+            waited += backoff;
+
+            /* A sensor still in reset may not answer, keep polling until the timeout */
+            if ((get_regs(reg_addr, &data, 1, dev) == BMI090L_OK) && ((data & mask) == value))
+            {
+                ready = TRUE;
+            }
+
+            if (backoff < BMI090L_POLL_BACKOFF_MAX_US)
+            {
+                backoff *= 2;
+            }
+        }
+    }
+}
+
+/*!
+ * @brief This API waits for the sensor without blocking.
+ */
+static uint8_t init_wait(struct bmi090l_init_ctx *ctx,
+                         uint8_t reg_addr,
+                         uint8_t mask,
+                         uint8_t value,
+                         uint32_t timeout_us,
+                         uint32_t *wait_us,
+                         struct bmi090l_dev *dev)
+{
+    uint32_t delay;
+    uint8_t data = 0;
+    uint8_t done = FALSE;
+
+    if (ctx->backoff_us == 0)
+    {
+        /* The action has just been issued */
+        ctx->waited_us = 0;
+    }
+    else if ((dev->wait_mode == BMI090L_WAIT_POLL) && (get_regs(reg_addr, &data, 1, dev) == BMI090L_OK) &&
+             ((data & mask) == value))
+    {
+        done = TRUE;
+    }
+    else if (ctx->waited_us >= timeout_us)
+    {
+        /* The caller checks the sensor state as after the fixed delay */
+        done = TRUE;
+    }
+
+    if (done)
+    {
+        ctx->backoff_us = 0;
+        *wait_us = 0;
+    }
+    else
+    {
+        if (dev->wait_mode != BMI090L_WAIT_POLL)
+        {
+            delay = timeout_us - ctx->waited_us;
+        }
+        else if (ctx->backoff_us == 0)
+        {
+            delay = BMI090L_POLL_BACKOFF_MIN_US;
+        }
+        else if (ctx->backoff_us < BMI090L_POLL_BACKOFF_MAX_US)
+        {
+            delay = ctx->backoff_us * 2;
+        }
+        else
+        {
+            delay = ctx->backoff_us;
+        }
+
+        if (delay > (timeout_us - ctx->waited_us))
+        {
+            delay = timeout_us - ctx->waited_us;
+        }
+
+        ctx->backoff_us = delay;
+        ctx->waited_us += delay;
+        *wait_us = delay;
+    }
+
+    return done;
+}
+
+/*!
+ * @brief This API returns the first state of the next selected initialization step.
+ */
+static uint8_t init_next(uint8_t steps, uint8_t state)
+{
+    if ((state == BMI090L_INIT_STATE_RESET) && !(steps & BMI090L_INIT_SOFT_RESET))
+    {
+        state = BMI090L_INIT_STATE_CONFIG;
+    }
+
+    if ((state == BMI090L_INIT_STATE_CONFIG) && !(steps & BMI090L_INIT_CONFIG_FILE))
+    {
+        state = BMI090L_INIT_STATE_POWER;
+    }
+
+    if ((state == BMI090L_INIT_STATE_POWER) && !(steps & BMI090L_INIT_POWER_MODE))
+    {
+        state = BMI090L_INIT_STATE_DONE;
+    }
+
+    return state;
+}
+
+/*!
+ * @brief This internal API appends one sample to a sample ring.
+ */
+static void sample_ring_put(struct bmi090l_sample_ring *ring,
+                            const struct bmi090l_sensor_data *data,
+                            uint32_t time_us)
+{
+    ring->x[ring->head] = data->x;
+    ring->y[ring->head] = data->y;
+    ring->z[ring->head] = data->z;
+
+    if (ring->time_us != NULL)
+    {
+        ring->time_us[ring->head] = time_us;
+    }
+
+    ring->head++;
+    if (ring->head >= ring->size)
+    {
+        ring->head = 0;
+    }
+
+    if (ring->count < ring->size)
+    {
+        ring->count++;
+    }
+}
+
 /*!
  *  @brief This API enables or disables the Gyro Self test feature in the
  *  sensor.
@@ -1254,13 +2560,14 @@ static void parse_fifo_gyro_len(uint16_t *len,
     }
     else if ((fifo_conf->tag == 1))
     {
+        /* Tagged frames carry two tag bytes behind the axis data */
         if (fifo_conf->data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
         {
-            *len = (uint16_t)((*gyr_count) * BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE);
+            *len = (uint16_t)((*gyr_count) * (BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE + 2));
         }
         else
         {
-            *len = (uint16_t)((*gyr_count) * BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE);
+            *len = (uint16_t)((*gyr_count) * (BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE + 2));
         }
     }
 }
@@ -1283,20 +2590,45 @@ static void unpack_gyro_data(struct bmi090l_sensor_data *gyro,
 
     idx = *data_index;
 
-    /* Gyroscope x data */
-    data_lsb = fifo->data[idx++];
-    data_msb = fifo->data[idx++];
-    gyro->x = (int16_t)((data_msb << 8) | data_lsb);
-
-    /* Gyroscope y data */
-    data_lsb = fifo->data[idx++];
-    data_msb = fifo->data[idx++];
-    gyro->y = (int16_t)((data_msb << 8) | data_lsb);
-
-    /* Gyroscope z data */
-    data_lsb = fifo->data[idx++];
-    data_msb = fifo->data[idx++];
-    gyro->z = (int16_t)((data_msb << 8) | data_lsb);
+    if (fifo_conf->data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
+    {
+        /* Gyroscope x data */
+        data_lsb = fifo->data[idx++];
+        data_msb = fifo->data[idx++];
+        gyro->x = (int16_t)((data_msb << 8) | data_lsb);
+
+        /* Gyroscope y data */
+        data_lsb = fifo->data[idx++];
+        data_msb = fifo->data[idx++];
+        gyro->y = (int16_t)((data_msb << 8) | data_lsb);
+
+        /* Gyroscope z data */
+        data_lsb = fifo->data[idx++];
+        data_msb = fifo->data[idx++];
+        gyro->z = (int16_t)((data_msb << 8) | data_lsb);
+    }
+    else
+    {
+        /* Single axis frames hold the selected axis only, the others read 0 */
+        data_lsb = fifo->data[idx++];
+        data_msb = fifo->data[idx++];
+        gyro->x = 0;
+        gyro->y = 0;
+        gyro->z = 0;
+
+        if (fifo_conf->data_select == BMI090L_GYRO_FIFO_X_AXIS_ENABLED)
+        {
+            gyro->x = (int16_t)((data_msb << 8) | data_lsb);
+        }
+        else if (fifo_conf->data_select == BMI090L_GYRO_FIFO_Y_AXIS_ENABLED)
+        {
+            gyro->y = (int16_t)((data_msb << 8) | data_lsb);
+        }
+        else
+        {
+            gyro->z = (int16_t)((data_msb << 8) | data_lsb);
+        }
+    }
 
     if (fifo_conf->tag == 1)
     {
@@ -1306,4 +2638,62 @@ static void unpack_gyro_data(struct bmi090l_sensor_data *gyro,
     *data_index = idx;
 }
 
+/*!
+ *  @brief This internal API unpacks XYZ gyroscope FIFO frames.
+ */
+static void unpack_gyro_xyz(int16_t *gyro_data, uint16_t *tag, uint16_t count, const uint8_t *fifo_data)
+{
+    uint16_t indx;
+
+    if (tag == NULL)
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            gyro_data[0] = (int16_t)((uint16_t)(fifo_data[1] << 8) | fifo_data[0]);
+            gyro_data[1] = (int16_t)((uint16_t)(fifo_data[3] << 8) | fifo_data[2]);
+            gyro_data[2] = (int16_t)((uint16_t)(fifo_data[5] << 8) | fifo_data[4]);
+            gyro_data += 3;
+            fifo_data += BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE;
+        }
+    }
+    else
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            gyro_data[0] = (int16_t)((uint16_t)(fifo_data[1] << 8) | fifo_data[0]);
+            gyro_data[1] = (int16_t)((uint16_t)(fifo_data[3] << 8) | fifo_data[2]);
+            gyro_data[2] = (int16_t)((uint16_t)(fifo_data[5] << 8) | fifo_data[4]);
+            tag[indx] = (uint16_t)((uint16_t)(fifo_data[7] << 8) | fifo_data[6]);
+            gyro_data += 3;
+            fifo_data += BMI090L_GYRO_FIFO_XYZ_AXIS_FRAME_SIZE + 2;
+        }
+    }
+}
+
+/*!
+ *  @brief This internal API unpacks single axis gyroscope FIFO frames.
+ */
+static void unpack_gyro_axis(int16_t *gyro_data, uint16_t *tag, uint16_t count, const uint8_t *fifo_data)
+{
+    uint16_t indx;
+
+    if (tag == NULL)
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            gyro_data[indx] = (int16_t)((uint16_t)(fifo_data[1] << 8) | fifo_data[0]);
+            fifo_data += BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE;
+        }
+    }
+    else
+    {
+        for (indx = 0; indx < count; indx++)
+        {
+            gyro_data[indx] = (int16_t)((uint16_t)(fifo_data[1] << 8) | fifo_data[0]);
+            tag[indx] = (uint16_t)((uint16_t)(fifo_data[3] << 8) | fifo_data[2]);
+            fifo_data += BMI090L_GYRO_FIFO_SINGLE_AXIS_FRAME_SIZE + 2;
+        }
+    }
+}
+
 /*! @endcond */
@@ -0,0 +1,868 @@
+/**
+ * Copyright (C) 2021 Bosch Sensortec GmbH
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * @file    sim_regression.c
+ * @brief   Runs the driver APIs against the BMI090L simulator and checks the results,
+ *          no hardware is needed. The exit status is non-zero if a check fails.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "bmi090l.h"
+#include "bmi090l_sim.h"
+
+/*********************************************************************/
+/*                            Macros                                 */
+/*********************************************************************/
+
+/* Buffer size allocated to store raw FIFO data */
+#define SIM_FIFO_BUFFER_SIZE                     UINT16_C(1200)
+
+/* Number of accel samples extracted per drain */
+#define SIM_ACCEL_FRAME_COUNT                    UINT16_C(200)
+
+/* Number of gyro frames extracted per drain, the gyro FIFO holds 100 frames */
+#define SIM_GYRO_FRAME_COUNT                     UINT16_C(100)
+
+/* Number of drains per FIFO check */
+#define SIM_DRAIN_COUNT                          UINT16_C(200)
+
+/* Virtual time between two drains, in microseconds */
+#define SIM_DRAIN_PERIOD_US                      UINT32_C(20000)
+
+/* Sensor time ticks between two accel samples at 400 Hz */
+#define SIM_ACCEL_400_HZ_TICKS                   UINT64_C(64)
+
+/* Offset of the y and z values of a gyro sample to its x value */
+#define SIM_GYRO_Y_OFFSET                        INT16_C(1000)
+#define SIM_GYRO_Z_OFFSET                        INT16_C(2000)
+
+/* Size of the FIFO_DATA reads of the chunked drain, not a multiple of the frame length */
+#define SIM_FIFO_CHUNK_SIZE                      UINT16_C(32)
+
+/* Size of the sample ring used by the polling check */
+#define SIM_RING_SIZE                            UINT16_C(8)
+
+/*********************************************************************/
+/*                       Global variables                            */
+/*********************************************************************/
+
+/* Simulated sensor, owned by the example */
+static struct bmi090l_sim sim;
+
+/* Gyro samples taken since the simulator was set up */
+static uint32_t gyro_seq;
+
+/* Number of failed checks */
+static uint32_t failed_checks;
+
+/*********************************************************************/
+/*                       Function Declarations                       */
+/*********************************************************************/
+
+/*!
+ * @brief Sample source of the simulator. Each accel sample carries the sensor
+ * time tick it was taken at, each gyro sample a running sequence number.
+ */
+static void sample_source(uint8_t sensor, uint64_t time_ns, struct bmi090l_sensor_data *data, void *ctx);
+
+/*!
+ * @brief Returns the sensor time tick stored in an accel sample by sample_source().
+ */
+static uint64_t accel_sample_tick(const struct bmi090l_sensor_data *data);
+
+/*!
+ * @brief Puts the simulator in its power-on state and attaches the device structure.
+ */
+static void sim_setup(struct bmi090l_dev *dev, enum bmi090l_intf intf);
+
+/*!
+ * @brief Initializes the accel, uploads the config file and streams 400 Hz samples into the FIFO.
+ */
+static int8_t accel_fifo_setup(struct bmi090l_dev *dev);
+
+/*!
+ * @brief Initializes the gyro and streams 2 kHz samples into the FIFO.
+ */
+static int8_t gyro_fifo_setup(struct bmi090l_gyr_fifo_config *fifo_conf, struct bmi090l_dev *dev);
+
+/*!
+ * @brief Prints the result of a check and counts the failed ones.
+ */
+static void report(const char *name, int8_t rslt, uint32_t errors);
+
+/*!
+ * @brief Checks that a device structure with only the interface members set, as
+ * for earlier releases, runs with the optional features off.
+ */
+static void check_legacy_dev(void);
+
+#ifdef BMI090L_BUS_STATS
+
+/*!
+ * @brief Checks that the bus statistics count a vectored transfer once and all of its bytes.
+ */
+static void check_xfer_stats(void);
+#endif
+
+/*!
+ * @brief Checks the config upload, the config ID read-back and the warm config apply.
+ */
+static void check_config_file(enum bmi090l_intf intf);
+
+/*!
+ * @brief Checks the accel FIFO drain and the sample timestamps for gaps and corrupt samples.
+ */
+static void check_accel_drain(enum bmi090l_intf intf, uint8_t dummy_byte_mode, uint8_t drain_mode);
+
+/*!
+ * @brief Checks the streaming parser on an accel FIFO drained in fixed size FIFO_DATA reads.
+ */
+static void check_fifo_parse_chunked(enum bmi090l_intf intf);
+
+/*!
+ * @brief Checks the streaming parser on FIFO reads split into chunks of varying size.
+ */
+static void check_fifo_parse_split(void);
+
+/*!
+ * @brief Checks the gyro FIFO drain and the packed extraction for a data selection and tag setting.
+ */
+static void check_gyro_drain(uint8_t data_select, uint8_t tag);
+
+/*!
+ * @brief Checks the sample ring of the polling APIs, including the rejection of an invalid ring.
+ */
+static void check_poll_samples(void);
+
+/*********************************************************************/
+/*                             Functions                             */
+/*********************************************************************/
+
+static void sample_source(uint8_t sensor, uint64_t time_ns, struct bmi090l_sensor_data *data, void *ctx)
+{
+    uint64_t tick;
+
+    (void)ctx;
+
+    if (sensor == BMI090L_SIM_ACCEL)
+    {
+        /* Sensor time runs at 25.6 kHz, 39062.5 ns per tick */
+        tick = (time_ns * 2 + 39062) / 78125;
+        data->x = (int16_t)(tick & 0x7FFF);
+        data->y = (int16_t)((tick >> 15) & 0x7FFF);
+        data->z = 0;
+    }
+    else
+    {
+        gyro_seq++;
+        data->x = (int16_t)gyro_seq;
+        data->y = (int16_t)(gyro_seq + SIM_GYRO_Y_OFFSET);
+        data->z = (int16_t)(gyro_seq + SIM_GYRO_Z_OFFSET);
+    }
+}
+
+static uint64_t accel_sample_tick(const struct bmi090l_sensor_data *data)
+{
+    return (uint64_t)(uint16_t)data->x | ((uint64_t)(uint16_t)data->y << 15);
+}
+
+static void sim_setup(struct bmi090l_dev *dev, enum bmi090l_intf intf)
+{
+    bmi090l_sim_init(&sim, intf);
+    sim.sample_cb = sample_source;
+    gyro_seq = 0;
+
+    (void)bmi090l_set_dev_defaults(dev);
+    bmi090l_sim_attach(&sim, dev);
+    dev->read_write_len = 32;
+}
+
+static int8_t accel_fifo_setup(struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+    struct bmi090l_accel_fifo_config config = { 0 };
+
+    rslt = bmi090la_init(dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_apply_config_file(dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->accel_cfg.power = BMI090L_ACCEL_PM_ACTIVE;
+        rslt = bmi090la_set_power_mode(dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->accel_cfg.odr = BMI090L_ACCEL_ODR_400_HZ;
+        dev->accel_cfg.range = BMI090L_ACCEL_RANGE_3G;
+        dev->accel_cfg.bw = BMI090L_ACCEL_BW_NORMAL;
+        rslt = bmi090la_set_meas_conf(dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        config.mode = BMI090L_ACC_STREAM_MODE;
+        config.accel_en = BMI090L_ENABLE;
+        rslt = bmi090la_set_fifo_config(&config, dev);
+    }
+
+    return rslt;
+}
+
+static int8_t gyro_fifo_setup(struct bmi090l_gyr_fifo_config *fifo_conf, struct bmi090l_dev *dev)
+{
+    int8_t rslt;
+
+    rslt = bmi090lg_init(dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->gyro_cfg.power = BMI090L_GYRO_PM_NORMAL;
+        rslt = bmi090lg_set_power_mode(dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        dev->gyro_cfg.odr = BMI090L_GYRO_BW_230_ODR_2000_HZ;
+        dev->gyro_cfg.bw = BMI090L_GYRO_BW_230_ODR_2000_HZ;
+        dev->gyro_cfg.range = BMI090L_GYRO_RANGE_2000_DPS;
+        rslt = bmi090lg_set_meas_conf(dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        fifo_conf->mode = BMI090L_GYRO_FIFO_MODE_STREAM;
+        rslt = bmi090lg_set_fifo_config(fifo_conf, dev);
+    }
+
+    return rslt;
+}
+
+static void report(const char *name, int8_t rslt, uint32_t errors)
+{
+    if ((rslt == BMI090L_OK) && (errors == 0) && (sim.protocol_errors == 0))
+    {
+        printf("[PASS] %s\n", name);
+    }
+    else
+    {
+        printf("[FAIL] %s : rslt %d, %lu errors, %lu protocol errors\n",
+               name,
+               rslt,
+               (unsigned long)errors,
+               (unsigned long)sim.protocol_errors);
+        failed_checks++;
+    }
+}
+
+static void check_legacy_dev(void)
+{
+    struct bmi090l_dev dev;
+    struct bmi090l_dev gyro_dev;
+    int8_t rslt;
+    uint32_t errors = 0;
+    uint16_t accel_length = SIM_ACCEL_FRAME_COUNT;
+    uint16_t fifo_length = 0;
+    static uint8_t fifo_data[SIM_FIFO_BUFFER_SIZE];
+    struct bmi090l_fifo_frame fifo = { 0 };
+    struct bmi090l_sensor_data accel[SIM_ACCEL_FRAME_COUNT];
+    struct bmi090l_sensor_data gyro = { 1, -2, 3 };
+
+    /* Stack garbage in every member the caller does not set */
+    (void)memset(&dev, 0xA5, sizeof(dev));
+    bmi090l_sim_init(&sim, BMI090L_SPI_INTF);
+    sim.sample_cb = sample_source;
+    bmi090l_sim_attach(&sim, &dev);
+    dev.read_write_len = 32;
+
+    rslt = accel_fifo_setup(&dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090lg_init(&dev);
+    }
+
+    errors += (dev.ext_key != BMI090L_DEV_EXT_KEY) + (dev.xfer != NULL) + (dev.read_async != NULL) +
+              (dev.timestamp_us != NULL) + (dev.shadow.enable != BMI090L_DISABLE) +
+              (dev.dummy_byte_mode != BMI090L_DUMMY_BYTE_COPY) + (dev.wait_mode != BMI090L_WAIT_FIXED);
+
+    if (rslt == BMI090L_OK)
+    {
+        bmi090l_sim_advance_us(&sim, SIM_DRAIN_PERIOD_US);
+        fifo.data = fifo_data;
+        fifo.length = SIM_FIFO_BUFFER_SIZE;
+        rslt = bmi090la_drain_fifo(&fifo, BMI090L_FIFO_DRAIN_EXACT, &fifo_length, &dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_extract_accel(accel, &accel_length, &fifo, &dev);
+        errors += (accel_length < 8);
+    }
+
+    /* Gyro-only user: the remap is the identity without any accel API */
+    if (rslt == BMI090L_OK)
+    {
+        (void)memset(&gyro_dev, 0xA5, sizeof(gyro_dev));
+        bmi090l_sim_attach(&sim, &gyro_dev);
+        gyro_dev.read_write_len = 32;
+        rslt = bmi090lg_init(&gyro_dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_remap_data(&gyro, 1, &gyro_dev);
+        errors += (gyro.x != 1) + (gyro.y != -2) + (gyro.z != 3);
+    }
+
+    report("legacy device structure", rslt, errors);
+}
+
+#ifdef BMI090L_BUS_STATS
+static void check_xfer_stats(void)
+{
+    struct bmi090l_dev dev;
+    static struct bmi090l_bus_stats stats;
+    struct bmi090l_gyr_fifo_config fifo_conf = { 0 };
+    int8_t rslt;
+    uint32_t errors = 0;
+    uint32_t xfer_txns = 0;
+    uint32_t read_bytes = 0;
+    uint32_t write_bytes = 0;
+    uint8_t api;
+
+    sim_setup(&dev, BMI090L_SPI_INTF);
+    dev.xfer = bmi090l_sim_xfer;
+    dev.shadow.enable = BMI090L_ENABLE;
+    dev.stats = &stats;
+    rslt = bmi090l_stats_reset(&dev);
+
+    /* The shadow fill of both init APIs and the FIFO config read are batched */
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_init(&dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090lg_init(&dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090lg_get_fifo_config(&fifo_conf, &dev);
+    }
+
+    for (api = 0; api < BMI090L_STATS_API_MAX; api++)
+    {
+        xfer_txns += stats.api[api].xfer_txns;
+        read_bytes += stats.api[api].read_bytes;
+        write_bytes += stats.api[api].write_bytes;
+    }
+
+    errors += (sim.xfer_count < 3) + (xfer_txns != sim.xfer_count) + (read_bytes != sim.read_bytes) +
+              (write_bytes != sim.write_bytes);
+
+    report("vectored transfer statistics", rslt, errors);
+}
+#endif
+
+static void check_config_file(enum bmi090l_intf intf)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    uint32_t errors = 0;
+    uint16_t config_major = 0;
+    uint16_t config_minor = 0;
+    uint8_t uploaded = FALSE;
+
+    sim_setup(&dev, intf);
+
+    /* First start: full upload, the host keeps the config ID read back */
+    rslt = bmi090la_init(&dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_apply_config_file(&dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_get_version_config(&config_major, &config_minor, &dev);
+    }
+
+    /* Host restart with the sensor still powered: the upload is skipped */
+    if (rslt == BMI090L_OK)
+    {
+        (void)bmi090l_set_dev_defaults(&dev);
+        bmi090l_sim_attach(&sim, &dev);
+        rslt = bmi090la_init(&dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_warm_apply_config_file(config_major, config_minor, &uploaded, &dev);
+        errors += (uploaded != FALSE);
+    }
+
+    /* A different config ID makes the upload run again */
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_warm_apply_config_file(config_major, (uint16_t)(config_minor ^ 1), &uploaded, &dev);
+        errors += (uploaded != TRUE);
+    }
+
+    /* A soft reset drops the config */
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_soft_reset(&dev);
+    }
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_warm_apply_config_file(config_major, config_minor, &uploaded, &dev);
+        errors += (uploaded != TRUE);
+    }
+
+    report(intf == BMI090L_SPI_INTF ? "config file, SPI" : "config file, I2C", rslt, errors);
+}
+
+static void check_accel_drain(enum bmi090l_intf intf, uint8_t dummy_byte_mode, uint8_t drain_mode)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    uint32_t errors = 0;
+    uint16_t drain;
+    uint16_t idx;
+    uint16_t fifo_length = 0;
+    uint16_t accel_length = 0;
+    uint64_t last_tick = 0;
+    uint32_t samples = 0;
+    uint32_t read_count;
+    char name[64];
+    static uint8_t fifo_data[SIM_FIFO_BUFFER_SIZE];
+    struct bmi090l_fifo_frame fifo;
+    struct bmi090l_fifo_timeline timeline;
+    struct bmi090l_sensor_data accel[SIM_ACCEL_FRAME_COUNT];
+    uint64_t sample_time[SIM_ACCEL_FRAME_COUNT];
+
+    sim_setup(&dev, intf);
+    dev.dummy_byte_mode = dummy_byte_mode;
+    (void)memset(&timeline, 0, sizeof(timeline));
+
+    rslt = accel_fifo_setup(&dev);
+
+    for (drain = 0; (drain < SIM_DRAIN_COUNT) && (rslt == BMI090L_OK); drain++)
+    {
+        bmi090l_sim_advance_us(&sim, SIM_DRAIN_PERIOD_US);
+
+        (void)memset(&fifo, 0, sizeof(fifo));
+        fifo.data = fifo_data;
+        fifo.length = SIM_FIFO_BUFFER_SIZE;
+        rslt = bmi090la_drain_fifo(&fifo, drain_mode, &fifo_length, &dev);
+
+        if (rslt == BMI090L_OK)
+        {
+            accel_length = SIM_ACCEL_FRAME_COUNT;
+            read_count = sim.read_count;
+            rslt = bmi090la_extract_accel_time(accel, sample_time, &accel_length, &fifo, &timeline, &dev);
+
+            /* The extraction works on the host copy of the configuration */
+            errors += (sim.read_count != read_count);
+
+            /* The end of the data is reached on every drain. On I2C, frames written
+             * during the read can push the sensor time frame out of it */
+            if ((rslt == BMI090L_W_FIFO_EMPTY) || (rslt == BMI090L_W_NO_SENSOR_TIME))
+            {
+                rslt = BMI090L_OK;
+            }
+        }
+
+        for (idx = 0; (idx < accel_length) && (rslt == BMI090L_OK); idx++)
+        {
+            /* No sample is lost or repeated between and within drains */
+            if ((last_tick != 0) && (accel_sample_tick(&accel[idx]) != last_tick + SIM_ACCEL_400_HZ_TICKS))
+            {
+                errors++;
+            }
+
+            /* Samples drained before the first sensor time frame have no timestamp yet */
+            if ((sample_time[idx] != 0) && (sample_time[idx] != accel_sample_tick(&accel[idx])))
+            {
+                errors++;
+            }
+
+            last_tick = accel_sample_tick(&accel[idx]);
+            samples++;
+        }
+    }
+
+    /* 20 ms of 400 Hz data per drain */
+    if (samples < (uint32_t)SIM_DRAIN_COUNT * 8)
+    {
+        errors++;
+    }
+
+    (void)snprintf(name,
+                   sizeof(name),
+                   "accel drain, %s%s, %s",
+                   (intf == BMI090L_SPI_INTF) ? "SPI" : "I2C",
+                   (dummy_byte_mode == BMI090L_DUMMY_BYTE_HEADROOM) ? " headroom" : "",
+                   (drain_mode == BMI090L_FIFO_DRAIN_EXACT) ? "exact" : "over-read");
+    report(name, rslt, errors);
+}
+
+static void check_fifo_parse_chunked(enum bmi090l_intf intf)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    int8_t parse_rslt;
+    uint32_t errors = 0;
+    uint16_t drain;
+    uint16_t idx;
+    uint16_t data_length;
+    uint16_t accel_length;
+    uint64_t last_tick = 0;
+    uint32_t samples = 0;
+    uint8_t chunk[SIM_FIFO_CHUNK_SIZE];
+    struct bmi090l_sensor_data accel[SIM_FIFO_CHUNK_SIZE];
+    struct bmi090l_fifo_parser parser;
+
+    sim_setup(&dev, intf);
+    rslt = accel_fifo_setup(&dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_fifo_parser_init(&parser);
+    }
+
+    for (drain = 0; (drain < SIM_DRAIN_COUNT) && (rslt == BMI090L_OK); drain++)
+    {
+        bmi090l_sim_advance_us(&sim, SIM_DRAIN_PERIOD_US);
+
+        /* Frames cut off at the end of a read are sent again by the next read */
+        do
+        {
+            rslt = bmi090la_get_regs(BMI090L_FIFO_DATA_ADDR, chunk, SIM_FIFO_CHUNK_SIZE, &dev);
+            parse_rslt = BMI090L_E_COM_FAIL;
+
+            if (rslt == BMI090L_OK)
+            {
+                rslt = bmi090la_fifo_parser_new_read(&parser);
+            }
+
+            if (rslt == BMI090L_OK)
+            {
+                data_length = SIM_FIFO_CHUNK_SIZE;
+                accel_length = SIM_FIFO_CHUNK_SIZE;
+                parse_rslt = bmi090la_fifo_parse(&parser, chunk, &data_length, accel, &accel_length, &dev);
+                errors += (parse_rslt < BMI090L_OK) || (parse_rslt == BMI090L_W_PARTIAL_READ);
+                errors += ((parse_rslt == BMI090L_OK) && (data_length != SIM_FIFO_CHUNK_SIZE));
+            }
+
+            for (idx = 0; (idx < accel_length) && (rslt == BMI090L_OK); idx++)
+            {
+                /* No sample is lost, repeated or spliced from two frames */
+                if (((last_tick != 0) && (accel_sample_tick(&accel[idx]) != last_tick + SIM_ACCEL_400_HZ_TICKS)) ||
+                    (accel[idx].z != 0))
+                {
+                    errors++;
+                }
+
+                last_tick = accel_sample_tick(&accel[idx]);
+                samples++;
+            }
+        } while (parse_rslt == BMI090L_OK);
+    }
+
+    if (samples < (uint32_t)SIM_DRAIN_COUNT * 8)
+    {
+        errors++;
+    }
+
+    report(intf == BMI090L_SPI_INTF ? "chunked FIFO parse, SPI" : "chunked FIFO parse, I2C", rslt, errors);
+}
+
+static void check_fifo_parse_split(void)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    int8_t parse_rslt;
+    uint32_t errors = 0;
+    uint16_t drain;
+    uint16_t idx;
+    uint16_t offset;
+    uint16_t fifo_length = 0;
+    uint16_t data_length;
+    uint16_t accel_length;
+    uint16_t chunk_size = 1;
+    uint64_t last_tick = 0;
+    uint32_t samples = 0;
+    static uint8_t fifo_data[SIM_FIFO_BUFFER_SIZE];
+    struct bmi090l_fifo_frame fifo;
+    struct bmi090l_sensor_data accel[SIM_FIFO_CHUNK_SIZE];
+    struct bmi090l_fifo_parser parser;
+
+    sim_setup(&dev, BMI090L_SPI_INTF);
+    rslt = accel_fifo_setup(&dev);
+
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_fifo_parser_init(&parser);
+    }
+
+    for (drain = 0; (drain < SIM_DRAIN_COUNT) && (rslt == BMI090L_OK); drain++)
+    {
+        bmi090l_sim_advance_us(&sim, SIM_DRAIN_PERIOD_US);
+
+        (void)memset(&fifo, 0, sizeof(fifo));
+        fifo.data = fifo_data;
+        fifo.length = SIM_FIFO_BUFFER_SIZE;
+        rslt = bmi090la_drain_fifo(&fifo, BMI090L_FIFO_DRAIN_EXACT, &fifo_length, &dev);
+        parse_rslt = BMI090L_OK;
+
+        if (rslt == BMI090L_OK)
+        {
+            rslt = bmi090la_fifo_parser_new_read(&parser);
+        }
+
+        /* One burst read handed over in chunks of 1 to 13 bytes, cutting frames anywhere */
+        for (offset = 0; (offset < fifo.length) && (rslt == BMI090L_OK) && (parse_rslt == BMI090L_OK);
+             offset += data_length)
+        {
+            data_length = (uint16_t)(fifo.length - offset);
+            if (data_length > chunk_size)
+            {
+                data_length = chunk_size;
+            }
+
+            chunk_size = (uint16_t)((chunk_size % 13) + 1);
+            accel_length = SIM_FIFO_CHUNK_SIZE;
+            parse_rslt = bmi090la_fifo_parse(&parser, &fifo_data[offset], &data_length, accel, &accel_length, &dev);
+
+            /* An exact drain ends on the last frame, the over-read marker is not reached */
+            errors += (parse_rslt != BMI090L_OK);
+
+            for (idx = 0; idx < accel_length; idx++)
+            {
+                /* No sample is lost, repeated or spliced from two frames */
+                if (((last_tick != 0) && (accel_sample_tick(&accel[idx]) != last_tick + SIM_ACCEL_400_HZ_TICKS)) ||
+                    (accel[idx].z != 0))
+                {
+                    errors++;
+                }
+
+                last_tick = accel_sample_tick(&accel[idx]);
+                samples++;
+            }
+        }
+    }
+
+    if (samples < (uint32_t)SIM_DRAIN_COUNT * 8)
+    {
+        errors++;
+    }
+
+    report("split FIFO parse", rslt, errors);
+}
+
+static void check_gyro_drain(uint8_t data_select, uint8_t tag)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    uint32_t errors = 0;
+    uint16_t drain;
+    uint16_t idx;
+    uint16_t frame_count = 0;
+    uint8_t fifo_overrun = 0;
+    uint8_t stride = (data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED) ? 3 : 1;
+    int16_t value;
+    int16_t last = 0;
+    uint32_t samples = 0;
+    char name[64];
+    static uint8_t fifo_data[SIM_FIFO_BUFFER_SIZE];
+    struct bmi090l_fifo_frame fifo;
+    struct bmi090l_gyr_fifo_config fifo_conf = { 0 };
+    int16_t gyro[SIM_GYRO_FRAME_COUNT * 3];
+    uint16_t gyro_tag[SIM_GYRO_FRAME_COUNT];
+
+    sim_setup(&dev, BMI090L_SPI_INTF);
+    sim.gyro_tag = UINT16_C(0xA5C3);
+
+    fifo_conf.data_select = data_select;
+    fifo_conf.tag = tag;
+    rslt = gyro_fifo_setup(&fifo_conf, &dev);
+
+    for (drain = 0; (drain < SIM_DRAIN_COUNT) && (rslt == BMI090L_OK); drain++)
+    {
+        bmi090l_sim_advance_us(&sim, SIM_DRAIN_PERIOD_US);
+
+        (void)memset(&fifo, 0, sizeof(fifo));
+        fifo.data = fifo_data;
+        fifo.length = SIM_FIFO_BUFFER_SIZE;
+        rslt = bmi090lg_drain_fifo(&fifo, &fifo_conf, &fifo_overrun, &dev);
+
+        /* 40 frames arrive per drain, the FIFO never overruns */
+        errors += (fifo_overrun != 0);
+
+        if (rslt == BMI090L_OK)
+        {
+            frame_count = SIM_GYRO_FRAME_COUNT;
+            rslt = bmi090lg_extract_gyro_packed(gyro, gyro_tag, &frame_count, &fifo_conf, &fifo);
+            errors += (frame_count != fifo_conf.frame_count);
+        }
+
+        for (idx = 0; (idx < frame_count) && (rslt == BMI090L_OK); idx++)
+        {
+            /* The selected axis carries the sequence number plus its offset */
+            value = gyro[idx * stride];
+
+            if (data_select == BMI090L_GYRO_FIFO_Y_AXIS_ENABLED)
+            {
+                value = (int16_t)(value - SIM_GYRO_Y_OFFSET);
+            }
+            else if (data_select == BMI090L_GYRO_FIFO_Z_AXIS_ENABLED)
+            {
+                value = (int16_t)(value - SIM_GYRO_Z_OFFSET);
+            }
+            else if (data_select == BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED)
+            {
+                errors += (gyro[idx * 3 + 1] != (int16_t)(value + SIM_GYRO_Y_OFFSET));
+                errors += (gyro[idx * 3 + 2] != (int16_t)(value + SIM_GYRO_Z_OFFSET));
+            }
+
+            errors += ((last != 0) && (value != (int16_t)(last + 1)));
+            errors += ((tag == BMI090L_GYRO_FIFO_TAG_ENABLED) && (gyro_tag[idx] != sim.gyro_tag));
+            last = value;
+            samples++;
+        }
+    }
+
+    if (samples < (uint32_t)SIM_DRAIN_COUNT * 40)
+    {
+        errors++;
+    }
+
+    (void)snprintf(name, sizeof(name), "gyro drain, data_select %u, tag %u", data_select, tag);
+    report(name, rslt, errors);
+}
+
+static void check_poll_samples(void)
+{
+    struct bmi090l_dev dev;
+    int8_t rslt;
+    int8_t invalid_rslt;
+    uint32_t errors = 0;
+    uint16_t n_read = 0;
+    uint16_t idx;
+    int16_t x[SIM_RING_SIZE + 1];
+    int16_t y[SIM_RING_SIZE + 1];
+    int16_t z[SIM_RING_SIZE + 1];
+    struct bmi090l_sensor_data older = { 0 };
+    struct bmi090l_sensor_data newer = { 0 };
+    struct bmi090l_sample_ring ring = { 0 };
+
+    sim_setup(&dev, BMI090L_SPI_INTF);
+    rslt = accel_fifo_setup(&dev);
+
+    /* The entry behind the ring must never be written */
+    x[SIM_RING_SIZE] = y[SIM_RING_SIZE] = z[SIM_RING_SIZE] = INT16_C(0x7FFF);
+    ring.x = x;
+    ring.y = y;
+    ring.z = z;
+    ring.size = SIM_RING_SIZE;
+
+    /* 20 samples wrap the ring twice, the last 8 are kept in order */
+    if (rslt == BMI090L_OK)
+    {
+        rslt = bmi090la_poll_samples(&ring, 20, &n_read, &dev);
+        errors += (n_read != 20) + (ring.count != SIM_RING_SIZE) + (ring.head != 20 % SIM_RING_SIZE);
+
+        /* The oldest entry is at head once the ring is full */
+        for (idx = 1; idx < SIM_RING_SIZE; idx++)
+        {
+            older.x = x[(ring.head + idx - 1) % SIM_RING_SIZE];
+            older.y = y[(ring.head + idx - 1) % SIM_RING_SIZE];
+            newer.x = x[(ring.head + idx) % SIM_RING_SIZE];
+            newer.y = y[(ring.head + idx) % SIM_RING_SIZE];
+            errors += (accel_sample_tick(&newer) <= accel_sample_tick(&older));
+        }
+    }
+
+    /* A ring state out of range is rejected by both sensors */
+    if (rslt == BMI090L_OK)
+    {
+        ring.head = SIM_RING_SIZE;
+        invalid_rslt = bmi090la_poll_samples(&ring, 1, &n_read, &dev);
+        errors += (invalid_rslt != BMI090L_E_INVALID_INPUT);
+        invalid_rslt = bmi090lg_poll_samples(&ring, 1, &n_read, &dev);
+        errors += (invalid_rslt != BMI090L_E_INVALID_INPUT);
+
+        ring.head = 0;
+        ring.count = SIM_RING_SIZE + 1;
+        invalid_rslt = bmi090la_poll_samples(&ring, 1, &n_read, &dev);
+        errors += (invalid_rslt != BMI090L_E_INVALID_INPUT);
+        invalid_rslt = bmi090lg_poll_samples(&ring, 1, &n_read, &dev);
+        errors += (invalid_rslt != BMI090L_E_INVALID_INPUT);
+    }
+
+    errors += (x[SIM_RING_SIZE] != INT16_C(0x7FFF)) + (y[SIM_RING_SIZE] != INT16_C(0x7FFF)) +
+              (z[SIM_RING_SIZE] != INT16_C(0x7FFF));
+
+    report("poll samples", rslt, errors);
+}
+
+/*!
+ *  @brief Main Function where the execution getting started to test the code.
+ *
+ *  @return 0 if all checks passed, 1 otherwise
+ *
+ */
+int main(void)
+{
+    uint8_t data_select;
+    uint8_t tag;
+
+    check_legacy_dev();
+
+#ifdef BMI090L_BUS_STATS
+    check_xfer_stats();
+#endif
+
+    check_config_file(BMI090L_I2C_INTF);
+    check_config_file(BMI090L_SPI_INTF);
+
+    check_accel_drain(BMI090L_I2C_INTF, BMI090L_DUMMY_BYTE_COPY, BMI090L_FIFO_DRAIN_EXACT);
+    check_accel_drain(BMI090L_I2C_INTF, BMI090L_DUMMY_BYTE_COPY, BMI090L_FIFO_DRAIN_OVER_READ);
+    check_accel_drain(BMI090L_SPI_INTF, BMI090L_DUMMY_BYTE_COPY, BMI090L_FIFO_DRAIN_EXACT);
+    check_accel_drain(BMI090L_SPI_INTF, BMI090L_DUMMY_BYTE_COPY, BMI090L_FIFO_DRAIN_OVER_READ);
+    check_accel_drain(BMI090L_SPI_INTF, BMI090L_DUMMY_BYTE_HEADROOM, BMI090L_FIFO_DRAIN_EXACT);
+    check_accel_drain(BMI090L_SPI_INTF, BMI090L_DUMMY_BYTE_HEADROOM, BMI090L_FIFO_DRAIN_OVER_READ);
+
+    check_fifo_parse_chunked(BMI090L_I2C_INTF);
+    check_fifo_parse_chunked(BMI090L_SPI_INTF);
+    check_fifo_parse_split();
+
+    for (data_select = BMI090L_GYRO_FIFO_XYZ_AXIS_ENABLED; data_select <= BMI090L_GYRO_FIFO_Z_AXIS_ENABLED;
+         data_select++)
+    {
+        for (tag = BMI090L_GYRO_FIFO_TAG_DISABLED; tag <= BMI090L_GYRO_FIFO_TAG_ENABLED; tag++)
+        {
+            check_gyro_drain(data_select, tag);
+        }
+    }
+
+    check_poll_samples();
+
+    printf("%lu check(s) failed\n", (unsigned long)failed_checks);
+
+    return (failed_checks == 0) ? 0 : 1;
+}